@@ -174,7 +174,13 @@ ArnoldiReduce::loadWork()
 {
   pt_map_.clear();
 
-  const ParasiticResistorSeq &resistors = parasitics_->resistors(parasitic_network_);
+  // Resistors to external nodes are not part of the tree.
+  ParasiticResistorSeq resistors;
+  for (ParasiticResistor *resistor : parasitics_->resistors(parasitic_network_)) {
+    if (!parasitics_->isExternal(parasitics_->node1(resistor))
+        && !parasitics_->isExternal(parasitics_->node2(resistor)))
+      resistors.push_back(resistor);
+  }
   int resistor_count = resistors.size();
 
   termN = 0;
@@ -30,6 +30,8 @@
 #include "ArcDelayCalc.hh"
 #include "dcalc/ArcDcalcWaveforms.hh"
 #include "dcalc/PrimaDelayCalc.hh"
+#include "dcalc/DmpCeff.hh"
+#include "Report.hh"
 #include "Sta.hh"
 
 using std::string;
@@ -84,6 +86,26 @@ set_prima_reduce_order(size_t order)
   }
 }
 
+void
+report_dmp_ceff_stats()
+{
+  size_t solve_count, iteration_count, failure_count;
+  Sta *sta = Sta::sta();
+  dmpCeffStats(sta->arcDelayCalc(), solve_count, iteration_count, failure_count);
+  Report *report = sta->report();
+  report->reportLine("DMP Newton solves %zu iterations %zu (%.1f/solve) failures %zu",
+                     solve_count,
+                     iteration_count,
+                     solve_count ? iteration_count / double(solve_count) : 0.0,
+                     failure_count);
+}
+
+void
+reset_dmp_ceff_stats()
+{
+  resetDmpCeffStats(Sta::sta()->arcDelayCalc());
+}
+
 void
 find_delays()
 {
@@ -35,6 +35,7 @@
 #include <algorithm> // abs, min
 #include <cmath>    // sqrt, log
 
+#include "Mutex.hh"
 #include "Report.hh"
 #include "Debug.hh"
 #include "Units.hh"
@@ -58,7 +59,6 @@ using std::max;
 using std::sqrt;
 using std::log;
 using std::isnan;
-using std::function;
 
 // Tolerance (as a scale of value) for driver parameters (Ceff, delta t, t0).
 static const double driver_param_tol = .01;
@@ -79,6 +79,13 @@ enum DmpFunc { y20, y50, ipi };
 
 static const char *dmp_func_index_strings[] = {"y20", "y50", "Ipi"};
 
+// Driver parameter Newton-Raphson statistics of deleted delay calculators.
+// Each calculator counts its own solves and adds them here when it is deleted.
+static size_t dmp_deleted_solve_count = 0;
+static size_t dmp_deleted_iteration_count = 0;
+static size_t dmp_deleted_failure_count = 0;
+static std::mutex dmp_deleted_stats_lock;
+
 static double
 exp2(double x);
 
@@ -102,19 +109,22 @@ gateModelRd(const LibertyCell *cell,
 	    double c1,
 	    const Pvt *pvt,
 	    bool pocv_enabled);
+template <class EvalFunc>
 static void
 newtonRaphson(const int max_iter,
 	      double x[],
 	      const int n,
 	      const double x_tol,
 	      // eval(state) is called to fill fvec and fjac.
-	      function<void ()> eval,
+	      EvalFunc eval,
 	      // Temporaries supplied by caller.
 	      double *fvec,
 	      double **fjac,
 	      int *index,
 	      double *p,
-	      double *scale);
+	      double *scale,
+	      // Return value.
+	      int &iter_count);
 static void
 luSolve(double **a,
 	const int size,
@@ -156,6 +166,10 @@ public:
 			     ArcDelay &delay,
 			     Slew &slew);
   double ceff() { return ceff_; }
+  size_t solveCount() const { return solve_count_; }
+  size_t iterationCount() const { return iteration_count_; }
+  size_t failureCount() const { return failure_count_; }
+  void resetStats();
 
   // Given x_ as a vector of input parameters, fill fvec_ with the
   // equations evaluated at x_ and fjac_ with the jabobian evaluated at x_.
@@ -269,6 +283,10 @@ protected:
   double *scale_;
   double *p_;
   int *index_;
+  // Driver parameter Newton-Raphson statistics.
+  size_t solve_count_;
+  size_t iteration_count_;
+  size_t failure_count_;
 
   // Driver slew used to check load delay.
   double drvr_slew_;
@@ -286,7 +304,10 @@ DmpAlg::DmpAlg(int nr_order,
   c2_(0.0),
   rpi_(0.0),
   c1_(0.0),
-  nr_order_(nr_order)
+  nr_order_(nr_order),
+  solve_count_(0),
+  iteration_count_(0),
+  failure_count_(0)
 {
   x_ = new double[nr_order_];
   fvec_ = new double[nr_order_];
@@ -340,6 +361,9 @@ DmpAlg::init(const LibertyLibrary *drvr_library,
 }
 
 // Find Ceff, delta_t and t0 for the driver.
+// The solve is for one arc and analysis point. Each iteration looks up
+// the arc's own gate table model at the current ceff, so solves for
+// different arcs or corners share no work to batch.
 void
 DmpAlg::findDriverParams(double ceff)
 {
@@ -352,9 +376,19 @@ DmpAlg::findDriverParams(double ceff)
   double t0 = t_vth + log(1.0 - vth_) * rd_ * ceff - vth_ * dt;
   x_[DmpParam::dt] = dt;
   x_[DmpParam::t0] = t0;
-  newtonRaphson(100, x_, nr_order_, driver_param_tol,
-                [this] () { evalDmpEqns(); },
-		fvec_, fjac_, index_, p_, scale_);
+  int iter_count = 0;
+  solve_count_++;
+  try {
+    newtonRaphson(100, x_, nr_order_, driver_param_tol,
+                  [this] () { evalDmpEqns(); },
+                  fvec_, fjac_, index_, p_, scale_, iter_count);
+  }
+  catch (DmpError &) {
+    iteration_count_ += iter_count;
+    failure_count_++;
+    throw;
+  }
+  iteration_count_ += iter_count;
   t0_ = x_[DmpParam::t0];
   dt_ = x_[DmpParam::dt];
   debugPrint(debug_, "dmp_ceff", 3, "    t0 = %s dt = %s ceff = %s",
@@ -1289,20 +1323,24 @@ DmpZeroC2::voCrossingUpperBound()
 // x_tol is percentage that all changes in x must be less than (1.0 = 100%).
 // Eval(state) is called to fill fvec and fjac (returns false if fails).
 // Return error msg on failure.
+template <class EvalFunc>
 static void
 newtonRaphson(const int max_iter,
 	      double x[],
 	      const int size,
 	      const double x_tol,
-	      function<void ()> eval,
+	      EvalFunc eval,
 	      // Temporaries supplied by caller.
 	      double *fvec,
 	      double **fjac,
 	      int *index,
 	      double *p,
-	      double *scale)
+	      double *scale,
+	      // Return value.
+	      int &iter_count)
 {
   for (int k = 0; k < max_iter; k++) {
+    iter_count = k + 1;
     eval();
     for (int i = 0; i < size; i++)
       // Right-hand side of linear equations.
@@ -1481,6 +1519,54 @@ testLuDecomp2()
 
 ////////////////////////////////////////////////////////////////
 
+void
+dmpCeffStats(const ArcDelayCalc *arc_delay_calc,
+             // Return values.
+             size_t &solve_count,
+             size_t &iteration_count,
+             size_t &failure_count)
+{
+  {
+    LockGuard lock(dmp_deleted_stats_lock);
+    solve_count = dmp_deleted_solve_count;
+    iteration_count = dmp_deleted_iteration_count;
+    failure_count = dmp_deleted_failure_count;
+  }
+  const DmpCeffDelayCalc *dmp_calc =
+    dynamic_cast<const DmpCeffDelayCalc*>(arc_delay_calc);
+  if (dmp_calc) {
+    size_t calc_solve_count, calc_iteration_count, calc_failure_count;
+    dmp_calc->stats(calc_solve_count, calc_iteration_count, calc_failure_count);
+    solve_count += calc_solve_count;
+    iteration_count += calc_iteration_count;
+    failure_count += calc_failure_count;
+  }
+}
+
+void
+resetDmpCeffStats(ArcDelayCalc *arc_delay_calc)
+{
+  {
+    LockGuard lock(dmp_deleted_stats_lock);
+    dmp_deleted_solve_count = 0;
+    dmp_deleted_iteration_count = 0;
+    dmp_deleted_failure_count = 0;
+  }
+  DmpCeffDelayCalc *dmp_calc = dynamic_cast<DmpCeffDelayCalc*>(arc_delay_calc);
+  if (dmp_calc)
+    dmp_calc->resetStats();
+}
+
+void
+DmpAlg::resetStats()
+{
+  solve_count_ = 0;
+  iteration_count_ = 0;
+  failure_count_ = 0;
+}
+
+////////////////////////////////////////////////////////////////
+
 bool DmpCeffDelayCalc::unsuppored_model_warned_ = false;
 
 DmpCeffDelayCalc::DmpCeffDelayCalc(StaState *sta) :
@@ -1494,11 +1580,44 @@ DmpCeffDelayCalc::DmpCeffDelayCalc(StaState *sta) :
 
 DmpCeffDelayCalc::~DmpCeffDelayCalc()
 {
+  size_t solve_count, iteration_count, failure_count;
+  stats(solve_count, iteration_count, failure_count);
+  if (solve_count > 0) {
+    LockGuard lock(dmp_deleted_stats_lock);
+    dmp_deleted_solve_count += solve_count;
+    dmp_deleted_iteration_count += iteration_count;
+    dmp_deleted_failure_count += failure_count;
+  }
   delete dmp_cap_;
   delete dmp_pi_;
   delete dmp_zero_c2_;
 }
 
+void
+DmpCeffDelayCalc::stats(// Return values.
+                        size_t &solve_count,
+                        size_t &iteration_count,
+                        size_t &failure_count) const
+{
+  solve_count = dmp_cap_->solveCount()
+    + dmp_pi_->solveCount()
+    + dmp_zero_c2_->solveCount();
+  iteration_count = dmp_cap_->iterationCount()
+    + dmp_pi_->iterationCount()
+    + dmp_zero_c2_->iterationCount();
+  failure_count = dmp_cap_->failureCount()
+    + dmp_pi_->failureCount()
+    + dmp_zero_c2_->failureCount();
+}
+
+void
+DmpCeffDelayCalc::resetStats()
+{
+  dmp_cap_->resetStats();
+  dmp_pi_->resetStats();
+  dmp_zero_c2_->resetStats();
+}
+
 ArcDcalcResult
 DmpCeffDelayCalc::gateDelay(const Pin *drvr_pin,
                             const TimingArc *arc,
@@ -35,6 +35,18 @@ class DmpPi;
 class DmpZeroC2;
 class GateTableModel;
 
+// Driver parameter Newton-Raphson solve, iteration and failure counts
+// of arc_delay_calc summed with the counts of deleted DMP delay
+// calculators (the per-thread copies).
+void
+dmpCeffStats(const ArcDelayCalc *arc_delay_calc,
+             // Return values.
+             size_t &solve_count,
+             size_t &iteration_count,
+             size_t &failure_count);
+void
+resetDmpCeffStats(ArcDelayCalc *arc_delay_calc);
+
 // Delay calculator using Dartu/Menezes/Pileggi effective capacitance
 // algorithm for RSPF loads.
 class DmpCeffDelayCalc : public LumpedCapDelayCalc
@@ -59,6 +71,12 @@ public:
                               const DcalcAnalysisPt *dcalc_ap,
                               int digits) override;
   void copyState(const StaState *sta) override;
+  // Driver parameter Newton-Raphson statistics for this calculator.
+  void stats(// Return values.
+             size_t &solve_count,
+             size_t &iteration_count,
+             size_t &failure_count) const;
+  void resetStats();
 
 protected:
   virtual void loadDelaySlew(const Pin *load_pin,
@@ -24,6 +24,8 @@
 
 #include "GraphDelayCalc.hh"
 
+#include <algorithm>
+
 #include "Debug.hh"
 #include "Stats.hh"
 #include "MinMax.hh"
@@ -46,6 +48,7 @@
 #include "NetCaps.hh"
 #include "ClkNetwork.hh"
 #include "Variables.hh"
+#include "DispatchQueue.hh"
 
 namespace sta {
 
@@ -54,6 +57,11 @@ using std::abs;
 using std::array;
 
 static const Slew default_slew = 0.0;
+// Maximum number of drivers with saved arc delay calculation results.
+// Each driver keeps the gate and load delays and slews of every arc and
+// analysis point, so the results of the least recently used drivers
+// are discarded when there are more drivers than this.
+static const size_t arc_dcalc_prev_drvr_max = 100000;
 
 static bool
 isLeafDriver(const Pin *pin,
@@ -66,6 +74,7 @@ GraphDelayCalc::GraphDelayCalc(StaState *sta) :
   incremental_(false),
   delays_exist_(false),
   invalid_delays_(new VertexSet(graph_)),
+  arc_dcalc_pass_(0),
   search_pred_(new SearchPred1(sta)),
   search_non_latch_pred_(new SearchPredNonLatch2(sta)),
   clk_pred_(new ClkTreeSearchPred(sta)),
@@ -146,6 +155,7 @@ GraphDelayCalc::delaysInvalid()
   invalid_delays_->clear();
   invalid_check_edges_.clear();
   invalid_latch_edges_.clear();
+  arc_dcalc_prevs_.clear();
 }
 
 void
@@ -177,6 +187,7 @@ GraphDelayCalc::delayInvalid(Vertex *vertex)
              vertex->to_string(this).c_str());
   if (graph_ && incremental_) {
     invalid_delays_->insert(vertex);
+    arc_dcalc_prevs_.erase(vertex);
     // Invalidate driver that triggers dcalc for multi-driver nets.
     MultiDrvrNet *multi_drvr = multiDrvrNet(vertex);
     if (multi_drvr)
@@ -190,6 +201,7 @@ GraphDelayCalc::deleteVertexBefore(Vertex *vertex)
   iter_->deleteVertexBefore(vertex);
   if (incremental_)
     invalid_delays_->erase(vertex);
+  arc_dcalc_prevs_.erase(vertex);
   MultiDrvrNet *multi_drvr = multiDrvrNet(vertex);
   if (multi_drvr) {
     // Don't bother incrementally updating MultiDrvrNet.
@@ -207,6 +219,7 @@ public:
   FindVertexDelays(GraphDelayCalc *graph_delay_calc1);
   virtual ~FindVertexDelays();
   virtual void visit(Vertex *vertex);
+  virtual void levelFinished();
   virtual VertexVisitor *copy() const;
 
 protected:
@@ -237,7 +250,14 @@ FindVertexDelays::copy() const
 void
 FindVertexDelays::visit(Vertex *vertex)
 {
-  graph_delay_calc_->findVertexDelay(vertex, arc_delay_calc_, true);
+  if (!graph_delay_calc_->deferMultiDrvrDelays(vertex))
+    graph_delay_calc_->findVertexDelay(vertex, arc_delay_calc_, true);
+}
+
+void
+FindVertexDelays::levelFinished()
+{
+  graph_delay_calc_->findMultiDrvrDelays();
 }
 
 // The logical structure of incremental delay calculation closely
@@ -259,19 +279,15 @@ GraphDelayCalc::findDelays(Level level)
       iter_->ensureSize();
     if (incremental_)
       seedInvalidDelays();
+    evictArcDcalcPrevs();
+    arc_dcalc_pass_++;
 
     FindVertexDelays visitor(this);
     dcalc_count += iter_->visitParallel(level, &visitor);
 
     // Timing checks require slews at both ends of the arc,
     // so find their delays after all slews are known.
-    for (Edge *check_edge : invalid_check_edges_)
-      findCheckEdgeDelays(check_edge, arc_delay_calc_);
-    invalid_check_edges_.clear();
-
-    for (Edge *latch_edge : invalid_latch_edges_)
-      findLatchEdgeDelays(latch_edge);
-    invalid_latch_edges_.clear();
+    findInvalidEdgeDelays();
 
     delays_exist_ = true;
     incremental_ = true;
@@ -280,6 +296,108 @@ GraphDelayCalc::findDelays(Level level)
   }
 }
 
+// Check and latch D->Q edges only annotate their own arc delays
+// so they are independent of each other.
+void
+GraphDelayCalc::findInvalidEdgeDelays()
+{
+  std::vector<Edge*> check_edges(invalid_check_edges_.begin(),
+                                 invalid_check_edges_.end());
+  std::vector<Edge*> latch_edges(invalid_latch_edges_.begin(),
+                                 invalid_latch_edges_.end());
+  invalid_check_edges_.clear();
+  invalid_latch_edges_.clear();
+  if (thread_count_ > 1
+      && check_edges.size() + latch_edges.size() > 1) {
+    std::vector<ArcDelayCalc*> arc_delay_calcs(thread_count_);
+    for (size_t i = 0; i < arc_delay_calcs.size(); i++)
+      arc_delay_calcs[i] = arc_delay_calc_->copy();
+    for (Edge *check_edge : check_edges) {
+      dispatch_queue_->dispatch([this, check_edge, &arc_delay_calcs](int i) {
+        findCheckEdgeDelays(check_edge, arc_delay_calcs[i]);
+      });
+    }
+    for (Edge *latch_edge : latch_edges) {
+      dispatch_queue_->dispatch([this, latch_edge, &arc_delay_calcs](int i) {
+        findLatchEdgeDelays(latch_edge, arc_delay_calcs[i]);
+      });
+    }
+    dispatch_queue_->finishTasks();
+    for (ArcDelayCalc *arc_delay_calc : arc_delay_calcs)
+      delete arc_delay_calc;
+  }
+  else {
+    for (Edge *check_edge : check_edges)
+      findCheckEdgeDelays(check_edge, arc_delay_calc_);
+    for (Edge *latch_edge : latch_edges)
+      findLatchEdgeDelays(latch_edge, arc_delay_calc_);
+  }
+}
+
+// Reduce parasitic networks to the models used by the arc delay
+// calculator ahead of delay calculation so the reductions for
+// independent nets run in parallel.
+void
+GraphDelayCalc::reduceParasitics(const Corner *corner,
+                                 const MinMaxAll *min_max)
+{
+  if (arc_delay_calc_ && arc_delay_calc_->reduceSupported()) {
+    Stats stats(debug_, report_);
+    DcalcAnalysisPtSeq dcalc_aps;
+    for (const Corner *corner1 : *corners_) {
+      if (corner == nullptr || corner1 == corner) {
+        for (const MinMax *min_max1 : min_max->range())
+          dcalc_aps.push_back(corner1->findDcalcAnalysisPt(min_max1));
+      }
+    }
+    PinSeq drvr_pins;
+    VertexIterator vertex_iter(graph_);
+    while (vertex_iter.hasNext()) {
+      Vertex *vertex = vertex_iter.next();
+      if (vertex->isDriver(network_))
+        drvr_pins.push_back(vertex->pin());
+    }
+
+    if (thread_count_ > 1) {
+      std::vector<ArcDelayCalc*> arc_delay_calcs(thread_count_);
+      for (size_t i = 0; i < arc_delay_calcs.size(); i++)
+        arc_delay_calcs[i] = arc_delay_calc_->copy();
+      for (const Pin *drvr_pin : drvr_pins) {
+        dispatch_queue_->dispatch([this, drvr_pin, &dcalc_aps,
+                                   &arc_delay_calcs](int i) {
+          reduceDrvrParasitics(drvr_pin, dcalc_aps, arc_delay_calcs[i]);
+        });
+      }
+      dispatch_queue_->finishTasks();
+      for (ArcDelayCalc *arc_delay_calc : arc_delay_calcs)
+        delete arc_delay_calc;
+    }
+    else {
+      for (const Pin *drvr_pin : drvr_pins)
+        reduceDrvrParasitics(drvr_pin, dcalc_aps, arc_delay_calc_);
+    }
+    debugPrint(debug_, "delay_calc", 1, "reduced parasitics for %zu drivers",
+               drvr_pins.size());
+    stats.report("Reduce parasitics");
+  }
+}
+
+void
+GraphDelayCalc::reduceDrvrParasitics(const Pin *drvr_pin,
+                                     const DcalcAnalysisPtSeq &dcalc_aps,
+                                     ArcDelayCalc *arc_delay_calc)
+{
+  for (const DcalcAnalysisPt *dcalc_ap : dcalc_aps) {
+    const ParasiticAnalysisPt *parasitic_ap = dcalc_ap->parasiticAnalysisPt();
+    // Only reduce annotated networks; wireload estimates are cheap.
+    if (parasitics_->findParasiticNetwork(drvr_pin, parasitic_ap)) {
+      for (const RiseFall *rf : RiseFall::range())
+        arc_delay_calc->findParasitic(drvr_pin, rf, dcalc_ap);
+    }
+  }
+  arc_delay_calc->finishDrvrPin();
+}
+
 void
 GraphDelayCalc::seedInvalidDelays()
 {
@@ -632,6 +750,60 @@ GraphDelayCalc::findVertexDelay(Vertex *vertex,
   }
 }
 
+// All of the drivers of a multi-driver net are found by the thread that
+// visits the dcalc driver, so wide busses serialize the level they are on.
+// With multiple threads the dcalc drivers are queued and found in a
+// separate pass over the nets when the level is finished. Each net is
+// found by one thread so the shared load slews are merged without races.
+bool
+GraphDelayCalc::deferMultiDrvrDelays(Vertex *vertex)
+{
+  if (thread_count_ > 1
+      && !vertex->isRoot()
+      && network_->isLeaf(vertex->pin())
+      && vertex->isDriver(network_)) {
+    MultiDrvrNet *multi_drvr = findMultiDrvrNet(vertex);
+    if (multi_drvr
+        && vertex == multi_drvr->dcalcDrvr()) {
+      LockGuard lock(multi_drvr_lock_);
+      multi_drvr_queue_.push_back(vertex);
+      return true;
+    }
+  }
+  return false;
+}
+
+void
+GraphDelayCalc::findMultiDrvrDelays()
+{
+  if (multi_drvr_queue_.size() == 1)
+    findVertexDelay(multi_drvr_queue_[0], arc_delay_calc_, true);
+  else if (multi_drvr_queue_.size() > 1) {
+    // Start the nets with the most drivers first.
+    std::sort(multi_drvr_queue_.begin(), multi_drvr_queue_.end(),
+              [this] (const Vertex *drvr1,
+                      const Vertex *drvr2) {
+                size_t count1 = multiDrvrNet(drvr1)->drvrs().size();
+                size_t count2 = multiDrvrNet(drvr2)->drvrs().size();
+                return count1 > count2
+                  || (count1 == count2
+                      && graph_->id(drvr1) < graph_->id(drvr2));
+              });
+    std::vector<ArcDelayCalc*> arc_delay_calcs(thread_count_);
+    for (size_t i = 0; i < arc_delay_calcs.size(); i++)
+      arc_delay_calcs[i] = arc_delay_calc_->copy();
+    for (Vertex *drvr_vertex : multi_drvr_queue_) {
+      dispatch_queue_->dispatch([this, drvr_vertex, &arc_delay_calcs](int i) {
+        findVertexDelay(drvr_vertex, arc_delay_calcs[i], true);
+      });
+    }
+    dispatch_queue_->finishTasks();
+    for (ArcDelayCalc *arc_delay_calc : arc_delay_calcs)
+      delete arc_delay_calc;
+  }
+  multi_drvr_queue_.clear();
+}
+
 DrvrLoadSlews
 GraphDelayCalc::loadSlews(LoadPinIndexMap &load_pin_index_map)
 {
@@ -887,7 +1059,8 @@ GraphDelayCalc::initRootSlews(Vertex *vertex)
 }
 
 void
-GraphDelayCalc::findLatchEdgeDelays(Edge *edge)
+GraphDelayCalc::findLatchEdgeDelays(Edge *edge,
+                                    ArcDelayCalc *arc_delay_calc)
 {
   Vertex *drvr_vertex = edge->to(graph_);
   const Pin *drvr_pin = drvr_vertex->pin();
@@ -897,7 +1070,7 @@ GraphDelayCalc::findLatchEdgeDelays(Edge *edge)
   array<bool, RiseFall::index_count> delay_exists = {false, false};
   LoadPinIndexMap load_pin_index_map = makeLoadPinIndexMap(drvr_vertex);
   bool delay_changed = findDriverEdgeDelays(drvr_vertex, nullptr, edge,
-                                            arc_delay_calc_, load_pin_index_map,
+                                            arc_delay_calc, load_pin_index_map,
                                             delay_exists);
   if (delay_changed && observer_)
     observer_->delayChangedTo(drvr_vertex);
@@ -981,18 +1154,122 @@ GraphDelayCalc::findDriverArcDelays(Vertex *drvr_vertex,
     else {
       Vertex *from_vertex = edge->from(graph_);
       const Slew in_slew = edgeFromSlew(from_vertex, from_rf, edge, dcalc_ap);
-      ArcDcalcResult dcalc_result = arc_delay_calc->gateDelay(drvr_pin, arc, in_slew,
-                                                              load_cap, parasitic,
-                                                              load_pin_index_map,
-                                                              dcalc_ap);
-      delay_changed |= annotateDelaysSlews(edge, arc, dcalc_result,
-                                           load_pin_index_map, dcalc_ap);
+      size_t load_count = load_pin_index_map.size();
+      // Only drivers found incrementally keep their arc results.
+      // Latch D->Q edges are found in parallel with other edges to the
+      // same driver so they do not.
+      ArcDcalcPrev *prev = (incremental_ && !edge->role()->isLatchDtoQ())
+        ? findArcDcalcPrev(drvr_vertex, edge, arc, dcalc_ap)
+        : nullptr;
+      if (arcDcalcPrevValid(prev, in_slew, load_cap, parasitic, load_count)) {
+        debugPrint(debug_, "delay_calc", 3, "    reuse previous arc delay");
+        delay_changed |= annotateDelaysSlews(edge, arc, prev->result,
+                                             load_pin_index_map, dcalc_ap);
+      }
+      else {
+        ArcDcalcResult dcalc_result = arc_delay_calc->gateDelay(drvr_pin, arc, in_slew,
+                                                                load_cap, parasitic,
+                                                                load_pin_index_map,
+                                                                dcalc_ap);
+        delay_changed |= annotateDelaysSlews(edge, arc, dcalc_result,
+                                             load_pin_index_map, dcalc_ap);
+        if (prev) {
+          prev->in_slew = in_slew;
+          prev->load_cap = load_cap;
+          prev->parasitic = parasitic;
+          prev->parasitic_serial = parasitic ? parasitics_->serial(parasitic) : 0;
+          prev->load_count = load_count;
+          prev->result = std::move(dcalc_result);
+        }
+      }
     }
     arc_delay_calc->finishDrvrPin();
   }
   return delay_changed;
 }
 
+// Discard the saved results of the least recently used drivers.
+// Called between passes so no thread has an entry.
+void
+GraphDelayCalc::evictArcDcalcPrevs()
+{
+  size_t drvr_count = arc_dcalc_prevs_.size();
+  if (drvr_count > arc_dcalc_prev_drvr_max) {
+    std::vector<size_t> passes;
+    passes.reserve(drvr_count);
+    for (const auto &drvr_prevs : arc_dcalc_prevs_)
+      passes.push_back(drvr_prevs.second.pass);
+    // Keep the drivers used in passes after the cutoff pass.
+    size_t evict_count = drvr_count - arc_dcalc_prev_drvr_max;
+    std::nth_element(passes.begin(), passes.begin() + evict_count - 1,
+                     passes.end());
+    size_t cutoff_pass = passes[evict_count - 1];
+    for (auto itr = arc_dcalc_prevs_.begin(); itr != arc_dcalc_prevs_.end(); ) {
+      if (itr->second.pass <= cutoff_pass)
+        itr = arc_dcalc_prevs_.erase(itr);
+      else
+        itr++;
+    }
+    debugPrint(debug_, "delay_calc", 1, "discard %zu previous driver delays",
+               drvr_count - arc_dcalc_prevs_.size());
+  }
+}
+
+// Find or make the previous result entry for a driver arc.
+// Entries are only touched by the thread finding the driver delays.
+ArcDcalcPrev *
+GraphDelayCalc::findArcDcalcPrev(Vertex *drvr_vertex,
+                                 const Edge *edge,
+                                 const TimingArc *arc,
+                                 const DcalcAnalysisPt *dcalc_ap)
+{
+  ArcDcalcDrvrPrevs *drvr_prevs;
+  {
+    LockGuard lock(arc_dcalc_prev_lock_);
+    drvr_prevs = &arc_dcalc_prevs_[drvr_vertex];
+  }
+  drvr_prevs->pass = arc_dcalc_pass_;
+  ArcDcalcPrevSeq &prevs = drvr_prevs->prevs;
+  DcalcAPIndex ap_index = dcalc_ap->index();
+  for (ArcDcalcPrev &prev : prevs) {
+    if (prev.edge == edge
+        && prev.arc == arc
+        && prev.ap_index == ap_index)
+      return &prev;
+  }
+  // New entries have no parasitic or load count that can match.
+  prevs.push_back({edge, arc, ap_index, Slew(), -1.0, nullptr, 0, 0,
+                   ArcDcalcResult()});
+  return &prevs.back();
+}
+
+// The previous arc result is reused when the load is the same and
+// the input slew is within the incremental delay tolerance.
+bool
+GraphDelayCalc::arcDcalcPrevValid(const ArcDcalcPrev *prev,
+                                  const Slew &in_slew,
+                                  float load_cap,
+                                  const Parasitic *parasitic,
+                                  size_t load_count) const
+{
+  if (prev
+      && prev->load_count == load_count
+      && prev->load_count > 0
+      && prev->parasitic == parasitic
+      // A new parasitic can have the address of a deleted one.
+      && (parasitic == nullptr
+          || prev->parasitic_serial == parasitics_->serial(parasitic))
+      && prev->load_cap == load_cap) {
+    if (delayEqual(in_slew, prev->in_slew))
+      return true;
+    float slew = delayAsFloat(in_slew);
+    float prev_slew = delayAsFloat(prev->in_slew);
+    return prev_slew > 0.0
+      && abs(slew - prev_slew) / prev_slew <= incremental_delay_tolerance_;
+  }
+  return false;
+}
+
 ArcDcalcArgSeq
 GraphDelayCalc::makeArcDcalcArgs(Vertex *drvr_vertex,
                                  const MultiDrvrNet *multi_drvr,
@@ -1258,6 +1535,17 @@ GraphDelayCalc::loadCap(const Pin *drvr_pin,
                         const DcalcAnalysisPt *dcalc_ap,
                         float &pin_cap,
                         float &wire_cap) const
+{
+  loadCap(drvr_pin, rf, dcalc_ap, arc_delay_calc_, pin_cap, wire_cap);
+}
+
+void
+GraphDelayCalc::loadCap(const Pin *drvr_pin,
+                        const RiseFall *rf,
+                        const DcalcAnalysisPt *dcalc_ap,
+                        ArcDelayCalc *arc_delay_calc,
+                        float &pin_cap,
+                        float &wire_cap) const
 {
   MultiDrvrNet *multi_drvr = nullptr;
   if (graph_) {
@@ -1265,9 +1553,9 @@ GraphDelayCalc::loadCap(const Pin *drvr_pin,
     multi_drvr = multiDrvrNet(drvr_vertex);
   }
   const Parasitic *parasitic;
-  parasiticLoad(drvr_pin, rf, dcalc_ap, multi_drvr, arc_delay_calc_,
+  parasiticLoad(drvr_pin, rf, dcalc_ap, multi_drvr, arc_delay_calc,
                 pin_cap, wire_cap, parasitic);
-  arc_delay_calc_->finishDrvrPin();
+  arc_delay_calc->finishDrvrPin();
 }
 
 float
@@ -1517,7 +1805,7 @@ GraphDelayCalc::findCheckEdgeDelays(Edge *edge,
                      delayAsString(check_delay, this));
 	  graph_->setArcDelay(edge, arc, ap_index, check_delay);
 	  delay_changed = true;
-          arc_delay_calc_->finishDrvrPin();
+          arc_delay_calc->finishDrvrPin();
 	}
       }
     }
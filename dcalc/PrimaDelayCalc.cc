@@ -67,7 +67,12 @@ PrimaDelayCalc::PrimaDelayCalc(StaState *sta) :
   load_pin_index_map_(nullptr),
   pin_node_map_(network_),
   node_index_map_(ParasiticNodeLess(parasitics_, network_)),
+  G_symbolic_stale_(true),
+  G_numeric_stale_(true),
+  A_symbolic_stale_(true),
+  A_reduced_(false),
   prima_order_(3),
+  reduced_stale_(true),
   make_waveforms_(false),
   waveform_drvr_pin_(nullptr),
   waveform_load_pin_(nullptr),
@@ -82,7 +87,12 @@ PrimaDelayCalc::PrimaDelayCalc(const PrimaDelayCalc &dcalc) :
   load_pin_index_map_(nullptr),
   pin_node_map_(network_),
   node_index_map_(ParasiticNodeLess(parasitics_, network_)),
+  G_symbolic_stale_(true),
+  G_numeric_stale_(true),
+  A_symbolic_stale_(true),
+  A_reduced_(false),
   prima_order_(dcalc.prima_order_),
+  reduced_stale_(true),
   make_waveforms_(false),
   waveform_drvr_pin_(nullptr),
   waveform_load_pin_(nullptr),
@@ -280,10 +290,33 @@ PrimaDelayCalc::simulate()
   stampEqns();
   setXinit();
 
-  if (prima_order_ > 0
-      && node_count_ > prima_order_) {
-    primaReduce();
-    simulate1(Gq_, Cq_, Bq_, xq_init_, Vq_, prima_order_);
+  bool reduce = prima_order_ > 0
+    && node_count_ > prima_order_;
+  // The full and reduced eqns have different A patterns.
+  if (reduce != A_reduced_) {
+    A_symbolic_stale_ = true;
+    A_reduced_ = reduce;
+  }
+  if (reduce) {
+    if (reduced_stale_)
+      primaReduce();
+    else
+      debugPrint(debug_, "ccs_dcalc", 2, "reuse reduced model");
+    // x = Vq * x~
+    // solve x_init = Vq * x~_init for x~_init
+    xq_init_ = Vq_solver_.solve(x_init_);
+    switch (prima_order_) {
+    case 2: simulateReduced<2>(); break;
+    case 3: simulateReduced<3>(); break;
+    case 4: simulateReduced<4>(); break;
+    case 5: simulateReduced<5>(); break;
+    case 6: simulateReduced<6>(); break;
+    case 7: simulateReduced<7>(); break;
+    case 8: simulateReduced<8>(); break;
+    default:
+      simulate1(Gq_, Cq_, Bq_, xq_init_, Vq_, prima_order_);
+      break;
+    }
   }
   else {
     Eigen::MatrixXd x_to_v = Eigen::MatrixXd::Identity(order_, order_);
@@ -316,8 +349,13 @@ PrimaDelayCalc::simulate1(const MatrixSd &G,
   MatrixSd A(order, order);
   A = G + (2.0 / time_step_) * C;
   A.makeCompressed();
-  SparseLU<MatrixSd> A_solver;
-  A_solver.compute(A);
+  // Only the numeric factorization depends on the time step.
+  if (A_symbolic_stale_) {
+    A_solver_.analyzePattern(A);
+    A_symbolic_stale_ = false;
+  }
+  A_solver_.factorize(A);
+  SparseLU<MatrixSd> &A_solver = A_solver_;
 
   // Initial time depends on ceff which impact delay, so use a sim step
   // to find an initial ceff.
@@ -369,6 +407,103 @@ PrimaDelayCalc::simulate1(const MatrixSd &G,
   }
 }
 
+// Fixed size version of simulate1 for the reduced model.
+// The step matrices are small so they are inverted once and each time step
+// is two fixed size matrix-vector products the compiler can vectorize.
+// Only pin node voltages are expanded from the reduced state.
+template <int order>
+void
+PrimaDelayCalc::simulateReduced()
+{
+  typedef Eigen::Matrix<double, order, order> MatrixN;
+  typedef Eigen::Matrix<double, order, 1> VectorN;
+  typedef Eigen::Matrix<double, order, Eigen::Dynamic> MatrixNP;
+  typedef Eigen::Matrix<double, Eigen::Dynamic, order> MatrixPN;
+
+  const std::vector<size_t> &pin_nodes = pin_nodes_;
+  MatrixPN x_to_pin_v(pin_nodes.size(), order);
+  for (size_t i = 0; i < pin_nodes.size(); i++)
+    x_to_pin_v.row(i) = Vq_.row(pin_nodes[i]);
+  Eigen::VectorXd pin_v(pin_nodes.size());
+  auto setPinVoltages = [&](const VectorN &x,
+                            Eigen::VectorXd &v) {
+    pin_v.noalias() = x_to_pin_v * x;
+    for (size_t i = 0; i < pin_nodes.size(); i++)
+      v[pin_nodes[i]] = pin_v[i];
+  };
+
+  VectorN x_init = xq_init_;
+  VectorN x = x_init;
+  VectorN x_prev = x_init;
+  VectorN x_prev2 = x_init;
+
+  v_.resize(order_);
+  v_prev_.resize(order_);
+
+  initCeffIdrvr();
+  setPinVoltages(x_init, v_);
+  setPinVoltages(x_init, v_prev_);
+
+  time_step_ = time_step_prev_ = timeStep();
+  debugPrint(debug_, "ccs_dcalc", 1, "time step %s", delayAsString(time_step_, this));
+
+  // A * x = B * u + 1/h * C * (3 * x_prev - x_prev2)
+  // x = Bs * u + Cs * (3 * x_prev - x_prev2)
+  MatrixN G = Gq_.toDense();
+  MatrixN C = Cq_.toDense();
+  MatrixN A = G + (2.0 / time_step_) * C;
+  Eigen::PartialPivLU<MatrixN> A_solver(A);
+  MatrixNP Bs = A_solver.solve(Bq_);
+  MatrixN Cs = A_solver.solve(C / time_step_);
+
+  // Initial time depends on ceff which impact delay, so use a sim step
+  // to find an initial ceff.
+  setPortCurrents();
+  x.noalias() = Bs * u_ + Cs * (3.0 * x_prev - x_prev2);
+  setPinVoltages(x, v_);
+
+  updateCeffIdrvr();
+  x = x_prev = x_prev2 = x_init;
+  setPinVoltages(x_init, v_);
+  setPinVoltages(x_init, v_prev_);
+
+  // voltageTime is always for a rising waveform so 0.0v is initial voltage.
+  double time_begin = output_waveforms_[0]->voltageTime((*dcalc_args_)[0].inSlewFlt(),
+                                                        ceff_[0], 0.0);
+  // Limit in case load voltage waveforms don't get to final value.
+  double time_end = time_begin + maxTime();
+
+  if (make_waveforms_)
+    recordWaveformStep(time_begin);
+
+  for (double time = time_begin; time <= time_end; time += time_step_) {
+    setPortCurrents();
+    x.noalias() = Bs * u_ + Cs * (3.0 * x_prev - x_prev2);
+    setPinVoltages(x, v_);
+
+    const ArcDcalcArg &dcalc_arg = (*dcalc_args_)[0];
+    debugPrint(debug_, "ccs_dcalc", 3, "%s ceff %s VDrvr %.4f Idrvr %s",
+               delayAsString(time, this),
+               units_->capacitanceUnit()->asString(ceff_[0]),
+               voltage(dcalc_arg.drvrPin()),
+               units_->currentUnit()->asString(drvr_current_[0], 4));
+
+    updateCeffIdrvr();
+
+    measureThresholds(time);
+    if (make_waveforms_)
+      recordWaveformStep(time);
+
+    if (loadWaveformsFinished())
+      break;
+
+    time_step_prev_ = time_step_;
+    x_prev2 = x_prev;
+    x_prev = x;
+    v_prev_.swap(v_);
+  }
+}
+
 double
 PrimaDelayCalc::timeStep()
 {
@@ -418,6 +553,7 @@ PrimaDelayCalc::findNodeCount()
   node_capacitances_.clear();
   pin_node_map_.clear();
   node_index_map_.clear();
+  pin_nodes_.clear();
 
   for (ParasiticNode *node : parasitics_->nodes(parasitic_network_)) {
     if (!parasitics_->isExternal(node)) {
@@ -426,6 +562,7 @@ PrimaDelayCalc::findNodeCount()
       const Pin *pin = parasitics_->pin(node);
       if (pin) {
         pin_node_map_[pin] = node_idx;
+        pin_nodes_.push_back(node_idx);
         debugPrint(debug_, "ccs_dcalc", 1, "pin %s node %lu",
                    network_->pathName(pin),
                    node_idx);
@@ -480,8 +617,7 @@ PrimaDelayCalc::setOrder()
   order_ = node_count_ + port_count_;
 
   // Matrix resize also zeros.
-  G_.resize(order_, order_);
-  C_.resize(order_, order_);
+  // G_ and C_ are sized by stampEqns when they change.
   B_.resize(order_, port_count_);
   u_.resize(port_count_);
   threshold_times_.resize(node_count_);
@@ -516,8 +652,8 @@ PrimaDelayCalc::setXinit()
 void
 PrimaDelayCalc::stampEqns()
 {
-  G_.setZero();
-  C_.setZero();
+  G_triplets_.clear();
+  C_triplets_.clear();
   B_.setZero();
 
   for (size_t node_idx = 0; node_idx < node_count_; node_idx++)
@@ -528,7 +664,10 @@ PrimaDelayCalc::stampEqns()
     ParasiticNode *node1 = parasitics_->node1(resistor);
     ParasiticNode *node2 = parasitics_->node2(resistor);
     // One commercial extractor creates resistors with identical from/to nodes.
-    if (node1 != node2) {
+    // Resistors to external nodes are not part of the network.
+    if (node1 != node2
+        && !parasitics_->isExternal(node1)
+        && !parasitics_->isExternal(node2)) {
       size_t node_idx1 = node_index_map_[node1];
       size_t node_idx2 = node_index_map_[node2];
       float resistance = parasitics_->value(resistor);
@@ -540,13 +679,27 @@ PrimaDelayCalc::stampEqns()
   for (size_t drvr_idx = 0; drvr_idx < drvr_count_; drvr_idx++) {
     const ArcDcalcArg &dcalc_arg = (*dcalc_args_)[drvr_idx];
     size_t drvr_node = pin_node_map_[dcalc_arg.drvrPin()];
-    G_.coeffRef(node_count_ + drvr_idx, drvr_node) = 1.0;
-    G_.coeffRef(node_count_ + drvr_idx, node_count_ + drvr_idx) = -1.0;
+    G_triplets_.emplace_back(node_count_ + drvr_idx, drvr_node, 1.0);
+    G_triplets_.emplace_back(node_count_ + drvr_idx, node_count_ + drvr_idx, -1.0);
     // special sauce
-    G_.coeffRef(drvr_node, drvr_node) += 1e-6;
+    stampConductance(drvr_node, 1e-6);
     B_.coeffRef(drvr_node, drvr_idx) = 1.0;
   }
 
+  bool G_changed, G_pattern_changed, C_changed, C_pattern_changed;
+  updateMatrix(G_triplets_, G_prev_triplets_, G_,
+               G_changed, G_pattern_changed);
+  updateMatrix(C_triplets_, C_prev_triplets_, C_,
+               C_changed, C_pattern_changed);
+  if (G_changed) {
+    G_numeric_stale_ = true;
+    G_symbolic_stale_ |= G_pattern_changed;
+  }
+  if (G_changed || C_changed)
+    reduced_stale_ = true;
+  if (G_pattern_changed || C_pattern_changed)
+    A_symbolic_stale_ = true;
+
   if (debug_->check("ccs_dcalc", 3)) {
     reportMatrix("G", G_);
     reportMatrix("C", C_);
@@ -554,12 +707,54 @@ PrimaDelayCalc::stampEqns()
   }
 }
 
+static bool
+tripletsEqual(const MatrixTripletSeq &triplets1,
+              const MatrixTripletSeq &triplets2,
+              bool compare_values)
+{
+  if (triplets1.size() != triplets2.size())
+    return false;
+  for (size_t i = 0; i < triplets1.size(); i++) {
+    const Eigen::Triplet<double> &triplet1 = triplets1[i];
+    const Eigen::Triplet<double> &triplet2 = triplets2[i];
+    if (triplet1.row() != triplet2.row()
+        || triplet1.col() != triplet2.col()
+        || (compare_values && triplet1.value() != triplet2.value()))
+      return false;
+  }
+  return true;
+}
+
+// Rebuild matrix from triplets if they differ from the previous call.
+void
+PrimaDelayCalc::updateMatrix(MatrixTripletSeq &triplets,
+                             MatrixTripletSeq &prev_triplets,
+                             MatrixSd &matrix,
+                             // Return values.
+                             bool &changed,
+                             bool &pattern_changed)
+{
+  // The order changes with the driver count even if the stamps do not.
+  bool resized = matrix.rows() != static_cast<Eigen::Index>(order_);
+  changed = resized
+    || !tripletsEqual(triplets, prev_triplets, true);
+  pattern_changed = resized
+    || (changed
+        && !tripletsEqual(triplets, prev_triplets, false));
+  if (changed) {
+    matrix.resize(order_, order_);
+    matrix.setFromTriplets(triplets.begin(), triplets.end());
+    matrix.makeCompressed();
+    prev_triplets.swap(triplets);
+  }
+}
+
 // Grounded resistor.
 void
 PrimaDelayCalc::stampConductance(size_t n1,
                                  double g)
 {
-  G_.coeffRef(n1, n1) += g;
+  G_triplets_.emplace_back(n1, n1, g);
 }
 
 // Floating resistor.
@@ -568,10 +763,10 @@ PrimaDelayCalc::stampConductance(size_t n1,
                                  size_t n2,
                                  double g)
 {
-  G_.coeffRef(n1, n1) += g;
-  G_.coeffRef(n2, n2) += g;
-  G_.coeffRef(n1, n2) -= g;
-  G_.coeffRef(n2, n1) -= g;
+  G_triplets_.emplace_back(n1, n1, g);
+  G_triplets_.emplace_back(n2, n2, g);
+  G_triplets_.emplace_back(n1, n2, -g);
+  G_triplets_.emplace_back(n2, n1, -g);
 }
 
 // Grounded capacitance.
@@ -579,7 +774,7 @@ void
 PrimaDelayCalc::stampCapacitance(size_t n1,
                                  double cap)
 {
-  C_.coeffRef(n1, n1) += cap;
+  C_triplets_.emplace_back(n1, n1, cap);
 }
 
 // Floating capacitance.
@@ -588,10 +783,10 @@ PrimaDelayCalc::stampCapacitance(size_t n1,
                                  size_t n2,
                                  double cap)
 {
-  C_.coeffRef(n1, n1) += cap;
-  C_.coeffRef(n2, n2) += cap;
-  C_.coeffRef(n1, n2) -= cap;
-  C_.coeffRef(n2, n1) -= cap;
+  C_triplets_.emplace_back(n1, n1, cap);
+  C_triplets_.emplace_back(n2, n2, cap);
+  C_triplets_.emplace_back(n1, n2, -cap);
+  C_triplets_.emplace_back(n2, n1, -cap);
 }
 
 ////////////////////////////////////////////////////////////////
@@ -760,6 +955,23 @@ void
 PrimaDelayCalc::setPrimaReduceOrder(size_t order)
 {
   prima_order_ = order;
+  reduced_stale_ = true;
+}
+
+// Factor G reusing the symbolic analysis when only values changed.
+void
+PrimaDelayCalc::factorG()
+{
+  if (G_numeric_stale_) {
+    if (G_symbolic_stale_) {
+      G_solver_.analyzePattern(G_);
+      G_symbolic_stale_ = false;
+    }
+    G_solver_.factorize(G_);
+    G_numeric_stale_ = false;
+  }
+  if (G_solver_.info() != Eigen::Success)
+    report_->error(1752, "G matrix is singular.");
 }
 
 // This version fills in one column of the orthonomal matrix
@@ -767,11 +979,9 @@ PrimaDelayCalc::setPrimaReduceOrder(size_t order)
 void
 PrimaDelayCalc::primaReduce()
 {
-  G_.makeCompressed();
   // Step 3: solve G*R = B for R
-  SparseLU<MatrixSd> G_solver(G_);
-  if (G_solver.info() != Eigen::Success)
-    report_->error(1752, "G matrix is singular.");
+  factorG();
+  SparseLU<MatrixSd> &G_solver = G_solver_;
   Eigen::MatrixXd R(order_, port_count_);
   R = G_solver.solve(B_);
 
@@ -805,10 +1015,10 @@ PrimaDelayCalc::primaReduce()
   Cq_ = Vqs.transpose() * C_ * Vqs;
   Gq_ = Vqs.transpose() * G_ * Vqs;
   Bq_ = Vqs.transpose() * B_;
-
-  // x = Vq * x~
-  // solve x_init = Vq * x~_init for x~_init
-  xq_init_ = Vq_.colPivHouseholderQr().solve(x_init_);
+  Vq_solver_.compute(Vq_);
+  reduced_stale_ = false;
+  // The projected matrix pattern depends on Vq.
+  A_symbolic_stale_ = true;
 
   if (debug_->check("ccs_dcalc", 3)) {
     reportMatrix("Vq", Vq_);
@@ -823,9 +1033,9 @@ PrimaDelayCalc::primaReduce()
 void
 PrimaDelayCalc::primaReduce2()
 {
-  G_.makeCompressed();
   // Step 3: solve G*R = B for R
-  Eigen::SparseLU<MatrixSd> G_solver(G_);
+  factorG();
+  SparseLU<MatrixSd> &G_solver = G_solver_;
   Eigen::MatrixXd R(order_, port_count_);
   R = G_solver.solve(B_);
 
@@ -866,10 +1076,9 @@ PrimaDelayCalc::primaReduce2()
   Cq_ = Vqs.transpose() * C_ * Vqs;
   Gq_ = Vqs.transpose() * G_ * Vqs;
   Bq_ = Vqs.transpose() * B_;
-
-  // x = Vq * x~
-  // solve x_init = Vq * x~_init for x~_init
-  xq_init_ = Vq_.colPivHouseholderQr().solve(x_init_);
+  Vq_solver_.compute(Vq_);
+  reduced_stale_ = false;
+  A_symbolic_stale_ = true;
 
   if (debug_->check("ccs_dcalc", 3)) {
     reportMatrix("Vq", Vq_);
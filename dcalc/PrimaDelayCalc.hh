@@ -28,6 +28,7 @@
 #include <map>
 #include <Eigen/SparseCore>
 #include <Eigen/SparseLU>
+#include <Eigen/QR>
 
 #include "Map.hh"
 #include "LumpedCapDelayCalc.hh"
@@ -44,6 +45,7 @@ typedef Map<const Pin*, size_t, PinIdLess> PinNodeMap;
 typedef std::map<const ParasiticNode*, size_t, ParasiticNodeLess> NodeIndexMap;
 typedef Map<const Pin*, size_t> PortIndexMap;
 typedef Eigen::SparseMatrix<double> MatrixSd;
+typedef std::vector<Eigen::Triplet<double>> MatrixTripletSeq;
 typedef Map<const Pin*, Eigen::VectorXd, PinIdLess> PinLMap;
 typedef std::map<const Pin*, FloatSeq, PinIdLess> WatchPinValuesMap;
 
@@ -111,6 +113,8 @@ protected:
                  const Eigen::VectorXd &x_init,
                  const Eigen::MatrixXd &x_to_v,
                  const size_t order);
+  template <int order>
+  void simulateReduced();
   double maxTime();
   double timeStep();
   float driverResistance();
@@ -122,6 +126,13 @@ protected:
   void initCeffIdrvr();
   void setXinit();
   void stampEqns();
+  void updateMatrix(MatrixTripletSeq &triplets,
+                    MatrixTripletSeq &prev_triplets,
+                    MatrixSd &matrix,
+                    // Return values.
+                    bool &changed,
+                    bool &pattern_changed);
+  void factorG();
   void stampConductance(size_t n1,
                         double g);
   void stampConductance(size_t n1,
@@ -175,6 +186,7 @@ protected:
 
   PinNodeMap pin_node_map_;     // Parasitic pin -> array index
   NodeIndexMap node_index_map_; // Parasitic node -> array index
+  std::vector<size_t> pin_nodes_; // Array indices of pin nodes
   std::vector<OutputWaveforms*> output_waveforms_;
   double resistance_sum_;
   
@@ -194,9 +206,28 @@ protected:
   Eigen::VectorXd x_init_;
   Eigen::VectorXd u_;
 
+  // The RC network is the same for rise/fall and analysis points that
+  // share parasitics, so G/C and their factorizations are kept until
+  // the stamped values change. Consecutive calls for a net use the same
+  // delay calculator (per thread), so one net is cached.
+  MatrixTripletSeq G_triplets_;
+  MatrixTripletSeq C_triplets_;
+  MatrixTripletSeq G_prev_triplets_;
+  MatrixTripletSeq C_prev_triplets_;
+  Eigen::SparseLU<MatrixSd> G_solver_;
+  bool G_symbolic_stale_;
+  bool G_numeric_stale_;
+  // Transient step matrix A = G + 2/h * C; the pattern is reused.
+  Eigen::SparseLU<MatrixSd> A_solver_;
+  bool A_symbolic_stale_;
+  // A_solver_ pattern is for the prima reduced eqns.
+  bool A_reduced_;
+
   // Prima reduced MNA eqns
   size_t prima_order_;
+  bool reduced_stale_;
   Eigen::MatrixXd Vq_;
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> Vq_solver_;
   MatrixSd Gq_;
   MatrixSd Cq_;
   Eigen::MatrixXd Bq_;
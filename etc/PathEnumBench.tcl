@@ -0,0 +1,69 @@
+# OpenSTA, Static Timing Analyzer
+# Copyright (c) 2025, Parallax Software, Inc.
+# 
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <https://www.gnu.org/licenses/>.
+# 
+# The origin of this software must not be misrepresented; you must not
+# claim that you wrote the original software.
+# 
+# Altered source versions must be plainly marked as such, and must not be
+# misrepresented as being the original software.
+# 
+# This notice may not be removed or altered from any source distribution.
+
+# Path enumeration benchmark.
+# Usage: sta -exit etc/PathEnumBench.tcl
+#
+# Each stage of the design is a buffer and an and gate that reconverge,
+# so there are 2^stages paths to the register at the end of the stages.
+# The paths are enumerated with find_timing_paths and the run time and
+# peak memory are reported. Run it with sta builds of two versions to
+# compare them.
+
+set stages 20
+set path_count 1000000
+
+set sta_dir [file join [file dirname [info script]] ".."]
+read_liberty [file join $sta_dir "examples" "sky130hd_tt.lib.gz"]
+
+set verilog_file [file join "/tmp" "path_enum_bench[pid].v"]
+set stream [open $verilog_file w]
+puts $stream "module top (in1, clk);"
+puts $stream "  input in1, clk;"
+puts $stream "  wire s0;"
+puts $stream "  sky130_fd_sc_hd__dfxtp_1 r1 (.D(in1), .CLK(clk), .Q(s0));"
+for {set i 1} {$i <= $stages} {incr i} {
+  set prev "s[expr $i - 1]"
+  puts $stream "  wire b$i, s$i;"
+  puts $stream "  sky130_fd_sc_hd__buf_1 u$i (.A($prev), .X(b$i));"
+  puts $stream "  sky130_fd_sc_hd__and2_1 a$i (.A($prev), .B(b$i), .X(s$i));"
+}
+puts $stream "  sky130_fd_sc_hd__dfxtp_1 r2 (.D(s$stages), .CLK(clk), .Q());"
+puts $stream "endmodule"
+close $stream
+
+read_verilog $verilog_file
+file delete $verilog_file
+link_design top
+create_clock -name clk -period 10 clk
+report_checks > /dev/null
+
+set start_time [elapsed_run_time]
+set paths [find_timing_paths -group_path_count $path_count \
+             -endpoint_path_count $path_count]
+set found_count [llength $paths]
+set run_time [expr [elapsed_run_time] - $start_time]
+unset paths
+puts [format "stages %d paths %d time %.2fs peak memory %.1fMB" \
+        $stages $found_count $run_time [expr [memory_usage] * 1e-6]]
@@ -55,7 +55,6 @@ public:
 
 protected:
   Report *report_;
-  std::mutex buffer_lock_;
   bool debug_on_;
   DebugMap *debug_map_;
   int stats_level_;
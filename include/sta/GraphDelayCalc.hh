@@ -27,11 +27,13 @@
 #include <vector>
 #include <mutex>
 #include <array>
+#include <unordered_map>
 
 #include "Map.hh"
 #include "NetworkClass.hh"
 #include "GraphClass.hh"
 #include "SearchClass.hh"
+#include "Corner.hh"
 #include "DcalcAnalysisPt.hh"
 #include "StaState.hh"
 #include "ArcDelayCalc.hh"
@@ -46,6 +48,35 @@ class NetCaps;
 typedef Map<const Vertex*, MultiDrvrNet*> MultiDrvrNetMap;
 typedef std::vector<SlewSeq> DrvrLoadSlews;
 
+// Arc delay calculation inputs and result saved for incremental reuse.
+class ArcDcalcPrev
+{
+public:
+  const Edge *edge;
+  const TimingArc *arc;
+  DcalcAPIndex ap_index;
+  Slew in_slew;
+  float load_cap;
+  const Parasitic *parasitic;
+  // Parasitics::serial of parasitic.
+  size_t parasitic_serial;
+  size_t load_count;
+  ArcDcalcResult result;
+};
+
+typedef std::vector<ArcDcalcPrev> ArcDcalcPrevSeq;
+
+// Saved arc results of a driver.
+class ArcDcalcDrvrPrevs
+{
+public:
+  // findDelays pass that last used the results.
+  size_t pass;
+  ArcDcalcPrevSeq prevs;
+};
+
+typedef std::unordered_map<const Vertex*, ArcDcalcDrvrPrevs> ArcDcalcPrevMap;
+
 // This class traverses the graph calling the arc delay calculator and
 // annotating delays on graph edges.
 class GraphDelayCalc : public StaState
@@ -68,6 +99,10 @@ public:
   virtual void findDelays(Level level);
   // Find and annotate drvr_vertex gate and load delays/slews.
   virtual void findDelays(Vertex *drvr_vertex);
+  // Reduce and save driver parasitic networks for corner/min_max.
+  // Null corner reduces all corners.
+  void reduceParasitics(const Corner *corner,
+                        const MinMaxAll *min_max);
   // Returned string is owned by the caller.
   virtual std::string reportDelayCalc(const Edge *edge,
                                       const TimingArc *arc,
@@ -90,6 +125,15 @@ public:
                // Return values.
                float &pin_cap,
                float &wire_cap) const;
+  // Load cap found with arc_delay_calc instead of arc_delay_calc_
+  // for callers on other threads.
+  void loadCap(const Pin *drvr_pin,
+               const RiseFall *rf,
+               const DcalcAnalysisPt *dcalc_ap,
+               ArcDelayCalc *arc_delay_calc,
+               // Return values.
+               float &pin_cap,
+               float &wire_cap) const;
   void netCaps(const Pin *drvr_pin,
                const RiseFall *rf,
                const DcalcAnalysisPt *dcalc_ap,
@@ -133,6 +177,9 @@ public:
   bool bidirectDrvrSlewFromLoad(const Pin *pin) const;
 
 protected:
+  void reduceDrvrParasitics(const Pin *drvr_pin,
+                            const DcalcAnalysisPtSeq &dcalc_aps,
+                            ArcDelayCalc *arc_delay_calc);
   void seedInvalidDelays();
   void initSlew(Vertex *vertex);
   void seedRootSlew(Vertex *vertex,
@@ -216,6 +263,8 @@ protected:
   void findVertexDelay(Vertex *vertex,
 		       ArcDelayCalc *arc_delay_calc,
 		       bool propagate);
+  bool deferMultiDrvrDelays(Vertex *vertex);
+  void findMultiDrvrDelays();
   DrvrLoadSlews loadSlews(LoadPinIndexMap &load_pin_index_map);
   bool loadSlewsChanged(DrvrLoadSlews &prev_load_slews,
                         LoadPinIndexMap &load_pin_index_map);
@@ -238,7 +287,19 @@ protected:
                           const ArcDelay &extra_delay,
                           bool merge,
                           const DcalcAnalysisPt *dcalc_ap);
-  void findLatchEdgeDelays(Edge *edge);
+  ArcDcalcPrev *findArcDcalcPrev(Vertex *drvr_vertex,
+                                  const Edge *edge,
+                                  const TimingArc *arc,
+                                  const DcalcAnalysisPt *dcalc_ap);
+  bool arcDcalcPrevValid(const ArcDcalcPrev *prev,
+                         const Slew &in_slew,
+                         float load_cap,
+                         const Parasitic *parasitic,
+                         size_t load_count) const;
+  void evictArcDcalcPrevs();
+  void findInvalidEdgeDelays();
+  void findLatchEdgeDelays(Edge *edge,
+                           ArcDelayCalc *arc_delay_calc);
   void findCheckEdgeDelays(Edge *edge,
 			   ArcDelayCalc *arc_delay_calc);
   void deleteMultiDrvrNets();
@@ -281,11 +342,21 @@ protected:
   EdgeSet invalid_latch_edges_;
   // shared by invalid_check_edges_ and invalid_latch_edges_
   std::mutex invalid_edge_lock_;
+  // Previous arc delay calculation results for incremental reuse
+  // of driver arcs with unchanged input slews and loads.
+  ArcDcalcPrevMap arc_dcalc_prevs_;
+  std::mutex arc_dcalc_prev_lock_;
+  // Count of findDelays passes used to find the least recently used
+  // saved results.
+  size_t arc_dcalc_pass_;
   SearchPred *search_pred_;
   SearchPred *search_non_latch_pred_;
   SearchPred *clk_pred_;
   BfsFwdIterator *iter_;
   MultiDrvrNetMap multi_drvr_net_map_;
+  // Multi-driver net dcalc drivers found at the current level.
+  VertexSeq multi_drvr_queue_;
+  // shared by multi_drvr_net_map_ and multi_drvr_queue_
   std::mutex multi_drvr_lock_;
   // Percentage (0.0:1.0) change in delay that causes downstream
   // delays to be recomputed during incremental delay calculation.
@@ -25,10 +25,14 @@
 #pragma once
 
 #include <mutex>
+#include <shared_mutex>
 
 namespace sta {
 
 // Hide a bit of the std verbosity.
 typedef std::lock_guard<std::mutex> LockGuard;
+// Reader/writer locks on std::shared_mutex.
+typedef std::shared_lock<std::shared_mutex> SharedLockGuard;
+typedef std::lock_guard<std::shared_mutex> UniqueLockGuard;
 
 } // namespace
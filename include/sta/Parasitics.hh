@@ -38,6 +38,7 @@ namespace sta {
 
 class Wireload;
 class Corner;
+class ReducedModelCache;
 
 typedef std::complex<float> ComplexFloat;
 typedef Vector<ComplexFloat> ComplexFloatSeq;
@@ -56,7 +57,7 @@ class Parasitics : public StaState
 {
 public:
   Parasitics(StaState *sta);
-  virtual ~Parasitics() {}
+  virtual ~Parasitics();
   virtual bool haveParasitics() = 0;
   // Clear all state.
   virtual void clear() = 0;
@@ -80,6 +81,9 @@ public:
 
   // Capacitance value of parasitic object.
   virtual float capacitance(const Parasitic *parasitic) const = 0;
+  // Number that is unique to each parasitic object made, so a parasitic
+  // is not mistaken for a deleted one that had the same address.
+  virtual size_t serial(const Parasitic *parasitic) const = 0;
 
   ////////////////////////////////////////////////////////////////
   // Pi model driver load with elmore delays to load pins (RSPF).
@@ -277,6 +281,8 @@ public:
   virtual void disconnectPinBefore(const Pin *pin,
                                    const Network *network) = 0;
   virtual void loadPinCapacitanceChanged(const Pin *pin) = 0;
+  // Net with the parasitic network that pin is connected to.
+  const Net *findParasiticNet(const Pin *pin) const;
 
 protected:
   void makeWireloadNetworkWorst(Parasitic *parasitic,
@@ -296,7 +302,8 @@ protected:
 				   float wireload_res,
 				   float fanout);
 
-  const Net *findParasiticNet(const Pin *pin) const;
+  // Reduced models shared between reductions of the same network.
+  ReducedModelCache *reduced_model_cache_;
 };
 
 // Managed by the Corner class.
@@ -40,6 +40,7 @@ class PathEndVisitor;
 typedef PathEndSeq::Iterator PathGroupIterator;
 typedef Map<const Clock*, PathGroup*> PathGroupClkMap;
 typedef Map<const char*, PathGroup*, CharPtrLess> PathGroupNamedMap;
+typedef Vector<PathGroup*> PathGroupSeq;
 
 // A collection of PathEnds grouped and sorted for reporting.
 class PathGroup
@@ -129,6 +130,13 @@ public:
                           const Corner *corner,
                           const MinMaxAll *min_max,
                           bool sort_by_slack);
+  // Make path ends one group at a time and pass them to func
+  // as soon as their report order is known.
+  void makePathEnds(ExceptionTo *to,
+                    bool unconstrained_paths,
+                    const Corner *corner,
+                    const MinMaxAll *min_max,
+                    const PathEndsFunc &func);
   PathGroup *findPathGroup(const char *name,
 			   const MinMax *min_max) const;
   PathGroup *findPathGroup(const Clock *clock,
@@ -138,6 +146,10 @@ public:
   static const char *asyncPathGroupName() { return async_group_name_; }
 
 protected:
+  void makeEndpointPathEnds(ExceptionTo *to,
+                            const Corner *corner,
+                            const MinMaxAll *min_max,
+                            PathGroup *only_group);
   void makeGroupPathEnds(ExceptionTo *to,
 			 int group_path_count,
 			 int endpoint_path_count,
@@ -156,8 +168,16 @@ protected:
 		    int group_path_count,
 		    int endpoint_path_count,
 		    bool unique_pins,
-		    bool cmp_slack);
-
+		    bool cmp_slack,
+		    bool thread_diversions);
+
+  bool streamGroupPathEnds(PathGroup *group,
+                           bool cmp_slack,
+                           const PathEndsFunc &func);
+  // Groups in report order.
+  void reportGroups(PathGroupSeq &groups);
+  void unconstrainedGroups(const MinMaxAll *min_max,
+                           PathGroupSeq &groups);
   void pushGroupPathEnds(PathEndSeq &path_ends);
   void pushUnconstrainedPathEnds(PathEndSeq &path_ends,
 				 const MinMaxAll *min_max);
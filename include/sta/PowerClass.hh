@@ -24,6 +24,11 @@
 
 #pragma once
 
+#include <utility>
+#include <vector>
+
+#include "NetworkClass.hh"
+
 namespace sta {
 
 class Power;
@@ -72,6 +77,9 @@ private:
   static constexpr float min_density = 1E-10;
 };
 
+typedef std::pair<const Pin*, PwrActivity> PwrPinActivity;
+typedef std::vector<PwrPinActivity> PwrPinActivitySeq;
+
 class PowerResult
 {
 public:
@@ -92,4 +100,6 @@ private:
   float leakage_;
 };
 
+typedef std::vector<PowerResult> PowerResultSeq;
+
 } // namespace
@@ -125,6 +125,10 @@ public:
   virtual size_t printString(const char *buffer,
                              size_t length);
   static Report *defaultReport() { return default_; }
+  // Lines printed by the calling thread are appended to lines
+  // instead of being printed until captureThreadLinesEnd is called.
+  static void captureThreadLinesBegin(std::string *lines);
+  static void captureThreadLinesEnd();
 
   // Suppress message by id.
   void suppressMsgId(int id);
@@ -164,6 +168,7 @@ protected:
   size_t buffer_length_;
   std::mutex buffer_lock_;
   static Report *default_;
+  static thread_local std::string *thread_lines_;
   std::set<int> suppressed_msg_ids_;
 
   friend class Debug;
@@ -25,11 +25,13 @@
 #pragma once
 
 #include <mutex>
+#include <atomic>
 
 #include "StringUtil.hh"
 #include "StringSet.hh"
 #include "Map.hh"
 #include "UnorderedMap.hh"
+#include "UnorderedSet.hh"
 #include "MinMax.hh"
 #include "StaState.hh"
 #include "NetworkClass.hh"
@@ -978,6 +980,9 @@ public:
                            const RiseFall *to_rf,
                            const MinMax *min_max,
                            ExceptionStateSet *&states) const;
+  // True if an edge to pin may match an exception -thru point.
+  // Exception states do not change on edges to any other pin.
+  bool isExceptionThruPin(const Pin *pin);
   // Find the highest priority exception with first exception pt at
   // pin/clk end.
   void exceptionTo(ExceptionPathType type,
@@ -1030,6 +1035,7 @@ public:
   void ensureClkHpinDisables();
 
 protected:
+  void ensureExceptionThruIndex();
   void portMembers(const Port *port,
                    PortSeq &ports);
   void initVariables();
@@ -1358,6 +1364,12 @@ protected:
   InstanceExceptionsMap first_to_inst_exceptions_;
   // Edges that traverse hierarchical exception pins.
   EdgeExceptionsMap first_thru_edge_exceptions_;
+  // Pins/nets/instances of every exception -thru point, built on demand.
+  UnorderedSet<const Pin*> exception_thru_pins_;
+  UnorderedSet<const Net*> exception_thru_nets_;
+  UnorderedSet<const Instance*> exception_thru_insts_;
+  std::atomic<bool> exception_thru_index_valid_;
+  std::mutex exception_thru_index_lock_;
   // Exception hash with one missing from/thru/to point, used for merging.
   ExceptionPathPtHash exception_merge_hash_;
   // Path delay -from pin internal startpoints.
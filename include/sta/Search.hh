@@ -26,9 +26,12 @@
 
 #include <mutex>
 #include <atomic>
+#include <map>
+#include <vector>
 
 #include "MinMax.hh"
 #include "UnorderedSet.hh"
+#include "UnorderedMap.hh"
 #include "Transition.hh"
 #include "LibertyClass.hh"
 #include "NetworkClass.hh"
@@ -68,6 +71,11 @@ typedef Set<ClkInfo*, ClkInfoLess> ClkInfoSet;
 typedef UnorderedSet<Tag*, TagHash, TagEqual> TagSet;
 typedef UnorderedSet<TagGroup*, TagGroupHash, TagGroupEqual> TagGroupSet;
 typedef Map<Vertex*, Slack> VertexSlackMap;
+// Sorted pin vertex ids in the fanin cone of an exception -to.
+typedef std::vector<VertexId> ExceptionToCone;
+// Keyed by the sorted -to pin vertex ids so exceptions share cones.
+typedef std::map<std::vector<VertexId>, ExceptionToCone*> ExceptionToConeCache;
+typedef UnorderedMap<const ExceptionPath*, const ExceptionToCone*> ExceptionToConeMap;
 typedef Vector<VertexSlackMap> VertexSlackMapSeq;
 typedef Vector<WorstSlacks> WorstSlacksSeq;
 typedef std::vector<DelayDbl> DelayDblSeq;
@@ -89,6 +97,11 @@ public:
   // disables additional search to returns approximate required times.
   bool crprApproxMissingRequireds() const;
   void setCrprApproxMissingRequireds(bool enabled);
+  // Required time change that is propagated to the fanin during
+  // incremental required time search.
+  // Defaults to 0.0 for maximum accuracy and slowest incremental speed.
+  float incrementalRequiredTolerance() const;
+  void setIncrementalRequiredTolerance(float tol);
 
   bool unconstrainedPaths() const { return unconstrained_paths_; }
   // from/thrus/to are owned and deleted by Search.
@@ -113,9 +126,32 @@ public:
                           bool removal,
                           bool clk_gating_setup,
                           bool clk_gating_hold);
+  // Pass path ends to func as soon as their report order is known
+  // instead of returning all of them.
+  void findPathEnds(ExceptionFrom *from,
+                    ExceptionThruSeq *thrus,
+                    ExceptionTo *to,
+                    bool unconstrained,
+                    const Corner *corner,
+                    const MinMaxAll *min_max,
+                    size_t group_path_count,
+                    size_t endpoint_path_count,
+                    bool unique_pins,
+                    float slack_min,
+                    float slack_max,
+                    PathGroupNameSet *group_names,
+                    bool setup,
+                    bool hold,
+                    bool recovery,
+                    bool removal,
+                    bool clk_gating_setup,
+                    bool clk_gating_hold,
+                    const PathEndsFunc &func);
   bool arrivalsValid();
   // Invalidate all arrival and required times.
   void arrivalsInvalid();
+  // Netlist edges were added so tag compression cones are stale.
+  void exceptionToConesInvalid();
   // Invalidate vertex arrival time.
   void arrivalInvalid(Vertex *vertex);
   void arrivalInvalid(const Pin *pin);
@@ -144,6 +180,10 @@ public:
   Slack totalNegativeSlack(const MinMax *min_max);
   Slack totalNegativeSlack(const Corner *corner,
 			   const MinMax *min_max);
+  // Compare the incremental total negative slacks with a full
+  // recompute and warn about differences.
+  // Return true if they are consistent.
+  bool checkTotalNegativeSlacks();
   // Worst endpoint slack and vertex.
   // Incrementally updated.
   void worstSlack(const MinMax *min_max,
@@ -155,6 +195,17 @@ public:
 		  // Return values.
 		  Slack &worst_slack,
 		  Vertex *&worst_vertex);
+  // Endpoints with the worst slacks in increasing slack order.
+  // Incrementally updated.
+  void worstEndpoints(const Corner *corner,
+                      const MinMax *min_max,
+                      size_t count,
+                      // Return value.
+                      VertexSeq &endpoints);
+  // Number of endpoints with slack less than threshold.
+  size_t endpointCount(const Corner *corner,
+                       const MinMax *min_max,
+                       Slack threshold);
   // Clock arrival respecting ideal clock insertion delay and latency.
   Arrival clkPathArrival(const Path *clk_path) const;
   Arrival clkPathArrival(const Path *clk_path,
@@ -330,6 +381,9 @@ public:
 	       ExceptionStateSet *states,
 	       bool own_states);
   void reportTags() const;
+  // Report the clocks, input delays and exceptions responsible for
+  // the most tags.
+  void reportTagProfile(int max_count) const;
   void reportClkInfos() const;
   virtual ClkInfo *findClkInfo(const ClockEdge *clk_edge,
 			       const Pin *clk_src,
@@ -525,6 +579,12 @@ protected:
 		 InputDelay *to_input_delay,
 		 const MinMax *min_max,
 		 const PathAnalysisPt *path_ap);
+  // True if state can still reach its exception -to from to_pin.
+  bool exceptionToReachable(ExceptionState *state,
+                            const Pin *to_pin) const;
+  void findExceptionToCones();
+  const ExceptionToCone *findExceptionToCone(ExceptionPath *exception);
+  ExceptionToCone *makeExceptionToCone(const PinSeq &to_pins);
   ExceptionPath *exceptionTo(const Path *path,
 			     const Pin *pin,
 			     const RiseFall *rf,
@@ -589,6 +649,7 @@ protected:
   bool unconstrained_paths_;
   bool crpr_path_pruning_enabled_;
   bool crpr_approx_missing_requireds_;
+  float incremental_required_tolerance_;
   // Search predicates.
   SearchPred *search_adj_;
   SearchPred *search_clk_;
@@ -659,6 +720,12 @@ protected:
   ExceptionTo *filter_to_;
   VertexSet *filtered_arrivals_;
   std::mutex filtered_arrivals_lock_;
+  // Exception -to fanin cones used by tag compression, found before
+  // the arrival search so threads read them without locking.
+  // Exceptions that can not be pruned are missing.
+  ExceptionToConeMap exception_to_cones_;
+  // Cones are kept across searches until the netlist changes.
+  ExceptionToConeCache exception_to_cone_cache_;
   bool found_downstream_clk_pins_;
   PathGroups *path_groups_;
   VisitPathEnds *visit_path_ends_;
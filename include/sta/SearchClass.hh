@@ -25,6 +25,7 @@
 #pragma once
 
 #include <limits>
+#include <functional>
 
 #include "Vector.hh"
 #include "Set.hh"
@@ -113,6 +114,9 @@ typedef Vector<MinPeriodCheck*> MinPeriodCheckSeq;
 typedef Vector<MaxSkewCheck*> MaxSkewCheckSeq;
 typedef StringSet PathGroupNameSet;
 typedef Vector<PathEnd*> PathEndSeq;
+// Called with successive path ends in report order.
+// The function owns the path ends.
+typedef std::function<void (PathEndSeq &path_ends)> PathEndsFunc;
 typedef Vector<Arrival> ArrivalSeq;
 typedef Map<Vertex*, size_t> VertexPathCountMap;
 typedef Map<Tag*, size_t, TagMatchLess> PathIndexMap;
@@ -25,6 +25,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "StringSeq.hh"
 #include "LibertyClass.hh"
@@ -68,11 +69,15 @@ class Corner;
 class ClkSkews;
 class ReportField;
 class EquivCells;
+class JournalEdit;
+class JournalRemap;
+class JournalParasiticNetwork;
 
 typedef InstanceSeq::Iterator SlowDrvrIterator;
 typedef Vector<const char*> CheckError;
 typedef Vector<CheckError*> CheckErrorSeq;
 typedef Vector<Corner*> CornerSeq;
+typedef std::vector<JournalEdit> JournalEditSeq;
 
 enum class CmdNamespace { sta, sdc };
 
@@ -862,6 +867,48 @@ public:
                      bool last);
   void reportPathEnd(PathEnd *end);
   void reportPathEnds(PathEndSeq *ends);
+  // Find and report path ends (see findPathEnds) one group at a time
+  // without holding all of them.
+  void reportPathEndsStream(ExceptionFrom *from,
+                            ExceptionThruSeq *thrus,
+                            ExceptionTo *to,
+                            bool unconstrained,
+                            const Corner *corner,
+                            const MinMaxAll *min_max,
+                            int group_path_count,
+                            int endpoint_path_count,
+                            bool unique_pins,
+                            float slack_min,
+                            float slack_max,
+                            bool sort_by_slack,
+                            PathGroupNameSet *group_names,
+                            bool setup,
+                            bool hold,
+                            bool recovery,
+                            bool removal,
+                            bool clk_gating_setup,
+                            bool clk_gating_hold);
+  // Write paths to a columnar binary file (see WriteTimingPaths.hh).
+  void writeTimingPaths(const char *filename,
+                        ExceptionFrom *from,
+                        ExceptionThruSeq *thrus,
+                        ExceptionTo *to,
+                        bool unconstrained,
+                        const Corner *corner,
+                        const MinMaxAll *min_max,
+                        int group_path_count,
+                        int endpoint_path_count,
+                        bool unique_pins,
+                        float slack_min,
+                        float slack_max,
+                        bool sort_by_slack,
+                        PathGroupNameSet *group_names,
+                        bool setup,
+                        bool hold,
+                        bool recovery,
+                        bool removal,
+                        bool clk_gating_setup,
+                        bool clk_gating_hold);
   ReportPath *reportPath() { return report_path_; }
   void reportPath(const Path *path);
 
@@ -923,6 +970,7 @@ public:
   Slack totalNegativeSlack(const MinMax *min_max);
   Slack totalNegativeSlack(const Corner *corner,
 			   const MinMax *min_max);
+  bool checkTotalNegativeSlacks();
   // Worst endpoint slack and vertex.
   // Incrementally updated.
   Slack worstSlack(const MinMax *min_max);
@@ -935,6 +983,17 @@ public:
 		  // Return values.
 		  Slack &worst_slack,
 		  Vertex *&worst_vertex);
+  // Endpoints with the worst slacks in increasing slack order.
+  // Incrementally updated.
+  void worstEndpoints(const Corner *corner,
+                      const MinMax *min_max,
+                      size_t count,
+                      // Return value.
+                      VertexSeq &endpoints);
+  // Number of endpoints with slack less than threshold.
+  size_t endpointCount(const Corner *corner,
+                       const MinMax *min_max,
+                       Slack threshold);
   VertexPathIterator *vertexPathIterator(Vertex *vertex,
 					 const RiseFall *rf,
 					 const PathAnalysisPt *path_ap);
@@ -1089,6 +1148,10 @@ public:
 		bool reduce);
   void reportParasiticAnnotation(bool report_unannotated,
                                  const Corner *corner);
+  // Reduce parasitic networks for the delay calculator in parallel
+  // ahead of delay calculation. Null corner reduces all corners.
+  void reduceParasitics(const Corner *corner,
+                        const MinMaxAll *min_max);
   // Parasitics.
   void findPiElmore(Pin *drvr_pin,
 		    const RiseFall *rf,
@@ -1145,6 +1208,16 @@ public:
   virtual void disconnectPin(Pin *pin);
   virtual void makePortPin(const char *port_name,
                            PortDirection *dir);
+  // Journal the network edits that follow so they can be undone.
+  // make_instance, delete_instance, make_net, delete_net, replace_cell,
+  // connect_pin and disconnect_pin are supported. Parasitic networks
+  // changed by the edits are restored by rollback.
+  void beginEditJournal();
+  bool inEditJournal() const { return edit_journal_ != nullptr; }
+  // Keep the edits since beginEditJournal.
+  void commitEditJournal();
+  // Undo the edits since beginEditJournal in reverse order.
+  void rollbackEditJournal();
   // Notify STA of network change.
   void networkChanged();
   void deleteLeafInstanceBefore(const Instance *inst);
@@ -1207,6 +1280,10 @@ public:
   // delays to be recomputed during incremental delay calculation.
   // Defaults to 0.0 for maximum accuracy and slowest incremental speed.
   void setIncrementalDelayTolerance(float tol);
+  // Required time change (in time units) that is propagated to the fanin
+  // during incremental required time search.
+  // Defaults to 0.0 for maximum accuracy and slowest incremental speed.
+  void setIncrementalRequiredTolerance(float tol);
   // Make graph and find delays.
   void searchPreamble();
 
@@ -1243,6 +1320,10 @@ public:
 	     PowerResult &pad);
   PowerResult power(const Instance *inst,
                     const Corner *corner);
+  // Design power for each read_vcd -interval activity interval.
+  void intervalPower(const Corner *corner,
+                     // Return value.
+                     PowerResultSeq &interval_powers);
   PwrActivity activity(const Pin *pin);
 
   void writeTimingModel(const char *lib_name,
@@ -1323,6 +1404,9 @@ public:
   // TCL variable sta_input_port_default_clock.
   bool useDefaultArrivalClock() const;
   void setUseDefaultArrivalClock(bool enable);
+  // TCL variable sta_tag_compression.
+  bool tagCompression() const;
+  void setTagCompression(bool enable);
   ////////////////////////////////////////////////////////////////
 
   Properties &properties() { return properties_; }
@@ -1449,6 +1533,12 @@ protected:
   void clkSkewPreamble();
   void setCmdNamespace1(CmdNamespace namespc);
   void setThreadCount1(int thread_count);
+  void undoJournalEdit(const JournalEdit &edit,
+                       JournalRemap &remap);
+  void saveJournalParasitics(const Net *net,
+                             JournalEdit &edit);
+  void restoreJournalParasitics(const std::vector<JournalParasiticNetwork> &saved_networks,
+                                const JournalRemap &remap);
 
   CmdNamespace cmd_namespace_;
   Instance *current_instance_;
@@ -1471,6 +1561,8 @@ protected:
   bool parasitics_per_corner_;
   bool parasitics_per_min_max_;
   Properties properties_;
+  // Network edits since beginEditJournal.
+  JournalEditSeq *edit_journal_;
 
   // Singleton sta used by tcl command interpreter.
   static Sta *sta_;
@@ -78,6 +78,11 @@ public:
   void setUseDefaultArrivalClock(bool enable);
   bool pocvEnabled() const { return pocv_enabled_; }
   void setPocvEnabled(bool enabled);
+  // TCL variable sta_tag_compression.
+  // Drop exception states from data tags that can not reach the
+  // exception -to so paths that differ only by them share a tag.
+  bool tagCompression() const { return tag_compression_; }
+  void setTagCompression(bool enable);
 
 private:
   bool crpr_enabled_;
@@ -94,6 +99,7 @@ private:
   bool propagate_all_clks_;
   bool use_default_arrival_clock_;
   bool pocv_enabled_;
+  bool tag_compression_;
 };
 
 } // namespace
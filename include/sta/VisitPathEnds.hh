@@ -47,6 +47,14 @@ public:
 		     const MinMaxAll *min_max,
 		     bool filtered,
 		     PathEndVisitor *visitor);
+  // Visit the path ends of endpoints on multiple threads.
+  // Each chunk of endpoints is visited with a copy of visitor that is
+  // merged into visitor with PathEndVisitor::merge in endpoint order.
+  void visitPathEnds(const VertexSeq &endpoints,
+		     const Corner *corner,
+		     const MinMaxAll *min_max,
+		     bool filtered,
+		     PathEndVisitor *visitor);
   bool checkEdgeEnabled(Edge *edge) const;
 
 protected:
@@ -155,6 +163,8 @@ public:
   virtual void visit(PathEnd *path_end) = 0;
   // End visiting the path ends for a vertex / path_index.
   virtual void vertexEnd(Vertex *) {}
+  // Merge the results of a copy used to visit a subset of the endpoints.
+  virtual void merge(PathEndVisitor *) {}
 };
 
 } // namespace
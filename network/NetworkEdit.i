@@ -97,6 +97,24 @@ disconnect_pin_cmd(Pin *pin)
   Sta::sta()->disconnectPin(pin);
 }
 
+void
+begin_what_if_cmd()
+{
+  Sta::sta()->beginEditJournal();
+}
+
+void
+commit_what_if_cmd()
+{
+  Sta::sta()->commitEditJournal();
+}
+
+void
+rollback_what_if_cmd()
+{
+  Sta::sta()->rollbackEditJournal();
+}
+
 // Notify STA of network change.
 void
 network_changed()
@@ -229,6 +229,26 @@ proc replace_cell { instance lib_cell } {
 
 ################################################################
 
+define_cmd_args "begin_what_if" {}
+
+proc begin_what_if {} {
+  begin_what_if_cmd
+}
+
+define_cmd_args "commit_what_if" {}
+
+proc commit_what_if {} {
+  commit_what_if_cmd
+}
+
+define_cmd_args "rollback_what_if" {}
+
+proc rollback_what_if {} {
+  rollback_what_if_cmd
+}
+
+################################################################
+
 proc path_regexp {} {
   global hierarchy_separator
   set id_regexp "\[^${hierarchy_separator}\]+"
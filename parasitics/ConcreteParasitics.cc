@@ -39,6 +39,7 @@
 #include "Parasitics.hh"
 #include "MakeConcreteParasitics.hh"
 #include "ConcreteParasiticsPvt.hh"
+#include "ReduceParasitics.hh"
 #include "Corner.hh"
 
 // Multiple inheritance is used to share elmore and pi model base
@@ -49,6 +50,13 @@ namespace sta {
 
 using std::max;
 
+std::atomic<size_t> ConcreteParasitic::serial_next_(1);
+
+ConcreteParasitic::ConcreteParasitic() :
+  serial_(serial_next_++)
+{
+}
+
 ConcreteParasitic::~ConcreteParasitic()
 {
 }
@@ -411,6 +419,17 @@ ConcreteParasiticNode::incrCapacitance(float cap)
   cap_ += cap;
 }
 
+void
+ConcreteParasiticNode::setSubnode(const Net *net,
+                                  int id,
+                                  bool is_external)
+{
+  net_pin_.net_ = net;
+  is_net_ = true;
+  is_external_ = is_external;
+  id_ = id;
+}
+
 const char *
 ConcreteParasiticNode::name(const Network *network) const
 {
@@ -504,44 +523,44 @@ ConcreteParasiticNetwork::ConcreteParasiticNetwork(const Net *net,
 
 ConcreteParasiticNetwork::~ConcreteParasiticNetwork()
 {
-  deleteDevices();
-  deleteNodes();
 }
 
-void
-ConcreteParasiticNetwork::deleteNodes()
+ParasiticResistorSeq
+ConcreteParasiticNetwork::resistors() const
 {
-  for (const auto& [id, node] : sub_nodes_)
-    delete node;
-  for (const auto& [pin, node] : pin_nodes_)
-    delete node;
+  ParasiticResistorSeq resistors;
+  resistors.reserve(resistors_.size());
+  for (const ConcreteParasiticResistor &resistor : resistors_)
+    resistors.push_back(const_cast<ConcreteParasiticResistor*>(&resistor));
+  return resistors;
 }
 
 void
-ConcreteParasiticNetwork::deleteDevices()
+ConcreteParasiticNetwork::makeResistor(size_t id,
+                                       float res,
+                                       ConcreteParasiticNode *node1,
+                                       ConcreteParasiticNode *node2)
 {
-  for (ParasiticResistor *resistor : resistors_) {
-    ConcreteParasiticResistor *cresistor =
-      reinterpret_cast<ConcreteParasiticResistor*>(resistor);
-    delete cresistor;
-  }
-  for (ParasiticCapacitor *capacitor : capacitors_) {
-    ConcreteParasiticCapacitor *ccapacitor =
-      reinterpret_cast<ConcreteParasiticCapacitor*>(capacitor);
-    delete ccapacitor;
-  }
+  resistors_.make(id, res, node1, node2);
 }
 
-void
-ConcreteParasiticNetwork::addResistor(ParasiticResistor *resistor)
+ParasiticCapacitorSeq
+ConcreteParasiticNetwork::capacitors() const
 {
-  resistors_.push_back(resistor);
+  ParasiticCapacitorSeq capacitors;
+  capacitors.reserve(capacitors_.size());
+  for (const ConcreteParasiticCapacitor &capacitor : capacitors_)
+    capacitors.push_back(const_cast<ConcreteParasiticCapacitor*>(&capacitor));
+  return capacitors;
 }
 
 void
-ConcreteParasiticNetwork::addCapacitor(ParasiticCapacitor *capacitor)
+ConcreteParasiticNetwork::makeCapacitor(size_t id,
+                                        float cap,
+                                        ConcreteParasiticNode *node1,
+                                        ConcreteParasiticNode *node2)
 {
-  capacitors_.push_back(capacitor);
+  capacitors_.make(id, cap, node1, node2);
 }
 
 ParasiticNodeSeq
@@ -569,11 +588,8 @@ ConcreteParasiticNetwork::capacitance() const
       cap += node->capacitance();
   }
 
-  for (ParasiticCapacitor *capacitor : capacitors_) {
-    ConcreteParasiticCapacitor *ccap =
-      static_cast<ConcreteParasiticCapacitor*>(capacitor);
-    cap += ccap->value();
-  }
+  for (const ConcreteParasiticCapacitor &capacitor : capacitors_)
+    cap += capacitor.value();
 
   return cap;
 }
@@ -611,7 +627,7 @@ ConcreteParasiticNetwork::ensureParasiticNode(const Net *net,
   auto id_node = sub_nodes_.find(net_id);
   if (id_node == sub_nodes_.end()) {
     Net *net1 = network->highestNetAbove(const_cast<Net*>(net));
-    node = new ConcreteParasiticNode(net, id, network->highestNetAbove(net1) != net_);
+    node = nodes_.make(net, id, network->highestNetAbove(net1) != net_);
     sub_nodes_[net_id] = node;
     if (net == net_)
       max_node_id_ = max((int) max_node_id_, id);
@@ -638,7 +654,7 @@ ConcreteParasiticNetwork::ensureParasiticNode(const Pin *pin,
     }
     else if (net)
       net = network->highestNetAbove(net);
-    node = new ConcreteParasiticNode(pin, net != net_);
+    node = nodes_.make(pin, net != net_);
     pin_nodes_[pin] = node;
   }
   else
@@ -706,23 +722,15 @@ ConcreteParasiticNetwork::disconnectPin(const Pin *pin,
   auto pin_node = pin_nodes_.find(pin);
   if (pin_node != pin_nodes_.end()) {
     ConcreteParasiticNode *node = pin_node->second;
-    // Make a subnode to replace the pin node.
-    ConcreteParasiticNode *subnode = ensureParasiticNode(net,max_node_id_+1,
-                                                         network);
-    // Hand over the devices.
-    for (ParasiticResistor *resistor : resistors_) {
-      ConcreteParasiticResistor *cresistor =
-        reinterpret_cast<ConcreteParasiticResistor*>(resistor);
-      cresistor->replaceNode(node, subnode);
-    }
-    for (ParasiticCapacitor *capacitor : capacitors_) {
-      ConcreteParasiticCapacitor *ccapacitor =
-        reinterpret_cast<ConcreteParasiticCapacitor*>(capacitor);
-      ccapacitor->replaceNode(node, subnode);
-    }
-
-    pin_nodes_.erase(pin);
-    delete node;
+    // The pin node becomes a subnode so its devices and ground
+    // capacitance stay in the network and no node is orphaned.
+    int id = max_node_id_ + 1;
+    Net *net1 = network->highestNetAbove(const_cast<Net*>(net));
+    node->setSubnode(net, id, network->highestNetAbove(net1) != net_);
+    sub_nodes_[NetIdPair(net, id)] = node;
+    if (net == net_)
+      max_node_id_ = id;
+    pin_nodes_.erase(pin_node);
   }
 }
 
@@ -804,6 +812,12 @@ ConcreteParasitics::deleteParasitics()
     }
   }
   parasitic_network_map_.clear();
+
+  size_t hits, misses;
+  reducedModelCacheStats(reduced_model_cache_, hits, misses);
+  debugPrint(debug_, "parasitic_reduce", 1, "reduced model cache hits %zu misses %zu",
+             hits, misses);
+  clearReducedModelCache(reduced_model_cache_);
 }
 
 void
@@ -847,6 +861,7 @@ ConcreteParasitics::deleteParasitics(const Net *net,
     delete parasitics[ap->index()];
     parasitics[ap->index()] = nullptr;
   }
+  clearReducedModelCache(reduced_model_cache_);
 }
 
 float
@@ -856,6 +871,13 @@ ConcreteParasitics::capacitance(const Parasitic *parasitic) const
   return cparasitic->capacitance();
 }
 
+size_t
+ConcreteParasitics::serial(const Parasitic *parasitic) const
+{
+  const ConcreteParasitic *cparasitic = static_cast<const ConcreteParasitic*>(parasitic);
+  return cparasitic->serial();
+}
+
 bool
 ConcreteParasitics::isReducedParasiticNetwork(const Parasitic *parasitic) const
 {
@@ -877,6 +899,7 @@ ConcreteParasitics::disconnectPinBefore(const Pin *pin,
 {
   if (haveParasitics()) {
     deleteReducedParasitics(pin);
+    clearReducedModelCache(reduced_model_cache_);
 
     const Net *net = findParasiticNet(pin);
     if (net) {
@@ -911,6 +934,7 @@ ConcreteParasitics::deleteReducedParasitics(const Net *net,
         deleteDrvrReducedParasitics(drvr_pin, ap);
     }
   }
+  clearReducedModelCache(reduced_model_cache_);
 }
 
 // Delete reduced models on pin's net.
@@ -929,7 +953,7 @@ ConcreteParasitics::deleteReducedParasitics(const Pin *pin)
 void
 ConcreteParasitics::deleteDrvrReducedParasitics(const Pin *drvr_pin)
 {
-  LockGuard lock(lock_);
+  UniqueLockGuard lock(lock_);
   ConcreteParasitic **parasitics = drvr_parasitic_map_[drvr_pin];
   if (parasitics) {
     int ap_count = corners_->parasiticAnalysisPtCount();
@@ -945,7 +969,7 @@ void
 ConcreteParasitics::deleteDrvrReducedParasitics(const Pin *drvr_pin,
                                                 const ParasiticAnalysisPt *ap)
 {
-  LockGuard lock(lock_);
+  UniqueLockGuard lock(lock_);
   ConcreteParasitic **parasitics = drvr_parasitic_map_[drvr_pin];
   if (parasitics) {
     int ap_index = ap->index();
@@ -968,7 +992,7 @@ ConcreteParasitics::findPiElmore(const Pin *drvr_pin,
 				 const RiseFall *rf,
 				 const ParasiticAnalysisPt *ap) const
 {
-  LockGuard lock(lock_);
+  SharedLockGuard lock(lock_);
   if (!drvr_parasitic_map_.empty()) {
     int ap_rf_index = parasiticAnalysisPtIndex(ap, rf);
     ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
@@ -989,7 +1013,7 @@ ConcreteParasitics::makePiElmore(const Pin *drvr_pin,
 				 float rpi,
 				 float c1)
 {
-  LockGuard lock(lock_);
+  UniqueLockGuard lock(lock_);
   ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
   if (parasitics == nullptr) {
     int ap_count = corners_->parasiticAnalysisPtCount();
@@ -1086,7 +1110,7 @@ ConcreteParasitics::findPiPoleResidue(const Pin *drvr_pin,
 {
   if (!drvr_parasitic_map_.empty()) {
     int ap_rf_index = parasiticAnalysisPtIndex(ap, rf);
-    LockGuard lock(lock_);
+    SharedLockGuard lock(lock_);
     ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
     if (parasitics) {
       ConcreteParasitic *parasitic = parasitics[ap_rf_index];
@@ -1109,7 +1133,7 @@ ConcreteParasitics::makePiPoleResidue(const Pin *drvr_pin,
 				      float rpi,
 				      float c1)
 {
-  LockGuard lock(lock_);
+  UniqueLockGuard lock(lock_);
   ConcreteParasitic **parasitics = drvr_parasitic_map_.findKey(drvr_pin);
   if (parasitics == nullptr) {
     int ap_count = corners_->parasiticAnalysisPtCount();
@@ -1203,7 +1227,7 @@ ConcreteParasitics::findParasiticNetwork(const Net *net,
 					 const ParasiticAnalysisPt *ap) const
 {
   if (!parasitic_network_map_.empty()) {
-    LockGuard lock(lock_);
+    SharedLockGuard lock(lock_);
     if (!parasitic_network_map_.empty()) {
       ConcreteParasiticNetwork **parasitics=parasitic_network_map_.findKey(net);
       if (parasitics) {
@@ -1222,7 +1246,7 @@ ConcreteParasitics::findParasiticNetwork(const Pin *pin,
 					 const ParasiticAnalysisPt *ap) const
 {
   if (!parasitic_network_map_.empty()) {
-    LockGuard lock(lock_);
+    SharedLockGuard lock(lock_);
     if (!parasitic_network_map_.empty()) {
       // Only call findParasiticNet if parasitics exist.
       const Net *net = findParasiticNet(pin);
@@ -1243,7 +1267,7 @@ ConcreteParasitics::makeParasiticNetwork(const Net *net,
 					 bool includes_pin_caps,
 					 const ParasiticAnalysisPt *ap)
 {
-  LockGuard lock(lock_);
+  UniqueLockGuard lock(lock_);
   ConcreteParasiticNetwork **parasitics = parasitic_network_map_.findKey(net);
   if (parasitics == nullptr) {
     int ap_count = corners_->parasiticAnalysisPtCount();
@@ -1271,7 +1295,7 @@ ConcreteParasitics::deleteParasiticNetwork(const Net *net,
 					   const ParasiticAnalysisPt *ap)
 {
   if (!parasitic_network_map_.empty()) {
-    LockGuard lock(lock_);
+    UniqueLockGuard lock(lock_);
     ConcreteParasiticNetwork **parasitics = parasitic_network_map_.findKey(net);
     if (parasitics) {
       int ap_index = ap->index();
@@ -1298,7 +1322,7 @@ void
 ConcreteParasitics::deleteParasiticNetworks(const Net *net)
 {
   if (!parasitic_network_map_.empty()) {
-    LockGuard lock(lock_);
+    UniqueLockGuard lock(lock_);
     ConcreteParasiticNetwork **parasitics = parasitic_network_map_.findKey(net);
     if (parasitics) {
       int ap_count = corners_->parasiticAnalysisPtCount();
@@ -1387,11 +1411,9 @@ ConcreteParasitics::makeCapacitor(Parasitic *parasitic,
 {
   ConcreteParasiticNode *cnode1 = static_cast<ConcreteParasiticNode*>(node1);
   ConcreteParasiticNode *cnode2 = static_cast<ConcreteParasiticNode*>(node2);
-  ConcreteParasiticCapacitor *capacitor =
-    new ConcreteParasiticCapacitor(index, cap, cnode1, cnode2);
   ConcreteParasiticNetwork *cparasitic =
     static_cast<ConcreteParasiticNetwork*>(parasitic);
-  cparasitic->addCapacitor(capacitor);
+  cparasitic->makeCapacitor(index, cap, cnode1, cnode2);
 }
 
 void
@@ -1403,11 +1425,9 @@ ConcreteParasitics::makeResistor(Parasitic *parasitic,
 {
   ConcreteParasiticNode *cnode1 = static_cast<ConcreteParasiticNode*>(node1);
   ConcreteParasiticNode *cnode2 = static_cast<ConcreteParasiticNode*>(node2);
-  ParasiticResistor *resistor = new ConcreteParasiticResistor(index, res,
-                                                              cnode1, cnode2);
   ConcreteParasiticNetwork *cparasitic =
     static_cast<ConcreteParasiticNetwork*>(parasitic);
-  cparasitic->addResistor(resistor);
+  cparasitic->makeResistor(index, res, cnode1, cnode2);
 }
 
 ParasiticNodeSeq
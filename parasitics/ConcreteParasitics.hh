@@ -24,7 +24,7 @@
 
 #pragma once
 
-#include <mutex>
+#include <shared_mutex>
 
 #include "Map.hh"
 #include "Set.hh"
@@ -60,6 +60,7 @@ public:
                                     bool is_reduced) override;
 
   float capacitance(const Parasitic *parasitic) const override;
+  size_t serial(const Parasitic *parasitic) const override;
 
   bool isPiElmore(const Parasitic *parasitic) const override;
   Parasitic *findPiElmore(const Pin *drvr_pin,
@@ -192,7 +193,9 @@ protected:
   // and transition.
   ConcreteParasiticMap drvr_parasitic_map_;
   ConcreteParasiticNetworkMap parasitic_network_map_;
-  mutable std::mutex lock_;
+  // Finds share the lock so delay calc lookups of reduced parasitics
+  // do not serialize.
+  mutable std::shared_mutex lock_;
 
   friend class ConcretePiElmore;
   friend class ConcreteParasiticNode;
@@ -24,8 +24,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <map>
+#include <new>
 #include <set>
+#include <utility>
 
 #include "Parasitics.hh"
 
@@ -34,6 +39,8 @@ namespace sta {
 class ConcretePoleResidue;
 class ConcreteParasiticDevice;
 class ConcreteParasiticNode;
+class ConcreteParasiticResistor;
+class ConcreteParasiticCapacitor;
 
 typedef std::pair<const Net*, int> NetIdPair;
 class NetIdPairLess
@@ -68,7 +75,9 @@ class ParasiticNetwork {};
 class ConcreteParasitic : public Parasitic
 {
 public:
+  ConcreteParasitic();
   virtual ~ConcreteParasitic();
+  size_t serial() const { return serial_; }
   virtual float capacitance() const = 0;
   virtual bool isPiElmore() const;
   virtual bool isPiModel() const;
@@ -94,6 +103,10 @@ public:
 			      ComplexFloatSeq *residues);
   virtual PinSet unannotatedLoads(const Pin *drvr_pin,
                                   const Parasitics *parasitics) const = 0;
+
+private:
+  size_t serial_;
+  static std::atomic<size_t> serial_next_;
 };
 
 // Pi model for a driver pin.
@@ -206,59 +219,6 @@ private:
   ConcretePoleResidueMap load_pole_residue_;
 };
 
-class ConcreteParasiticNetwork : public ParasiticNetwork,
-				 public ConcreteParasitic
-{
-public:
-  ConcreteParasiticNetwork(const Net *net,
-                           bool includes_pin_caps,
-                           const Network *network);
-  virtual ~ConcreteParasiticNetwork();
-  virtual bool isParasiticNetwork() const { return true; }
-  const Net *net() const { return net_; }
-  bool includesPinCaps() const { return includes_pin_caps_; }
-  ConcreteParasiticNode *findParasiticNode(const Net *net,
-                                           int id,
-                                           const Network *network) const;
-  ConcreteParasiticNode *ensureParasiticNode(const Net *net,
-					     int id,
-                                             const Network *network);
-  ConcreteParasiticNode *findParasiticNode(const Pin *pin) const;
-  ConcreteParasiticNode *ensureParasiticNode(const Pin *pin,
-                                             const Network *network);
-  virtual float capacitance() const;
-  ParasiticNodeSeq nodes() const;
-  void disconnectPin(const Pin *pin,
-		     const Net *net,
-                     const Network *network);
-  ParasiticResistorSeq resistors() const { return resistors_; }
-  void addResistor(ParasiticResistor *resistor);
-  ParasiticCapacitorSeq capacitors() const { return capacitors_; }
-  void addCapacitor(ParasiticCapacitor *capacitor);
-  virtual PinSet unannotatedLoads(const Pin *drvr_pin,
-                                  const Parasitics *parasitics) const;
-
-private:
-  void unannotatedLoads(ParasiticNode *node,
-                        ParasiticResistor *from_res,
-                        PinSet &loads,
-                        ParasiticNodeSet &visited_nodes,
-                        ParasiticResistorSet &loop_resistors,
-                        ParasiticNodeResistorMap &resistor_map,
-                        const Parasitics *parasitics) const;
-
-  void deleteNodes();
-  void deleteDevices();
-
-  const Net *net_;
-  ConcreteParasiticSubNodeMap sub_nodes_;
-  ConcreteParasiticPinNodeMap pin_nodes_;
-  ParasiticResistorSeq resistors_;
-  ParasiticCapacitorSeq capacitors_;
-  unsigned max_node_id_:31;
-  bool includes_pin_caps_:1;
-};
-
 class ConcreteParasiticNode : public ParasiticNode
 {
 public:
@@ -274,6 +234,10 @@ public:
   bool isExternal() const { return is_external_; }
   const Pin *pin() const;
   void incrCapacitance(float cap);
+  // Turn a pin node into subnode id of net when the pin is disconnected.
+  void setSubnode(const Net *net,
+                  int id,
+                  bool is_external);
 
 protected:
   ConcreteParasiticNode();
@@ -331,4 +295,162 @@ public:
                              ConcreteParasiticNode *node2);
 };
 
+// Nodes and devices are owned by the network and deleted with it.
+// They are allocated in chunks that start small and double in size,
+// so small networks do not pay for a large block and large networks
+// do not pay per-object allocation overhead. Objects do not move and
+// are iterated in the order they were made.
+template <class TYPE>
+class ConcreteParasiticArena
+{
+  class Chunk;
+
+public:
+  class Iterator
+  {
+  public:
+    Iterator(Chunk *chunk) : chunk_(chunk), index_(0) {}
+    TYPE &operator*() const { return chunk_->objects()[index_]; }
+    Iterator &operator++()
+    {
+      if (++index_ == chunk_->count) {
+        chunk_ = chunk_->next;
+        index_ = 0;
+      }
+      return *this;
+    }
+    bool operator!=(const Iterator &itr) const
+    { return chunk_ != itr.chunk_ || index_ != itr.index_; }
+
+  private:
+    Chunk *chunk_;
+    uint32_t index_;
+  };
+
+  ConcreteParasiticArena() : head_(nullptr), tail_(nullptr), size_(0) {}
+  ~ConcreteParasiticArena();
+  template <class... ARGS>
+  TYPE *make(ARGS&&... args);
+  size_t size() const { return size_; }
+  Iterator begin() const { return Iterator(head_); }
+  Iterator end() const { return Iterator(nullptr); }
+
+private:
+  class Chunk
+  {
+  public:
+    // Objects follow the chunk header.
+    TYPE *objects() { return reinterpret_cast<TYPE*>(this + 1); }
+
+    Chunk *next;
+    uint32_t capacity;
+    uint32_t count;
+  };
+  static_assert(sizeof(Chunk) % alignof(TYPE) == 0);
+
+  static constexpr uint32_t chunk_capacity_min_ = 4;
+  static constexpr uint32_t chunk_capacity_max_ = 1024;
+
+  Chunk *head_;
+  Chunk *tail_;
+  size_t size_;
+};
+
+template <class TYPE>
+ConcreteParasiticArena<TYPE>::~ConcreteParasiticArena()
+{
+  Chunk *chunk = head_;
+  while (chunk) {
+    Chunk *next = chunk->next;
+    for (uint32_t i = 0; i < chunk->count; i++)
+      chunk->objects()[i].~TYPE();
+    ::operator delete(chunk);
+    chunk = next;
+  }
+}
+
+template <class TYPE>
+template <class... ARGS>
+TYPE *
+ConcreteParasiticArena<TYPE>::make(ARGS&&... args)
+{
+  if (tail_ == nullptr || tail_->count == tail_->capacity) {
+    uint32_t capacity = tail_
+      ? std::min(tail_->capacity * 2, chunk_capacity_max_)
+      : chunk_capacity_min_;
+    Chunk *chunk = static_cast<Chunk*>(::operator new(sizeof(Chunk)
+                                                      + capacity * sizeof(TYPE)));
+    chunk->next = nullptr;
+    chunk->capacity = capacity;
+    chunk->count = 0;
+    if (tail_)
+      tail_->next = chunk;
+    else
+      head_ = chunk;
+    tail_ = chunk;
+  }
+  TYPE *object = new (tail_->objects() + tail_->count) TYPE(std::forward<ARGS>(args)...);
+  tail_->count++;
+  size_++;
+  return object;
+}
+
+class ConcreteParasiticNetwork : public ParasiticNetwork,
+				 public ConcreteParasitic
+{
+public:
+  ConcreteParasiticNetwork(const Net *net,
+                           bool includes_pin_caps,
+                           const Network *network);
+  virtual ~ConcreteParasiticNetwork();
+  virtual bool isParasiticNetwork() const { return true; }
+  const Net *net() const { return net_; }
+  bool includesPinCaps() const { return includes_pin_caps_; }
+  ConcreteParasiticNode *findParasiticNode(const Net *net,
+                                           int id,
+                                           const Network *network) const;
+  ConcreteParasiticNode *ensureParasiticNode(const Net *net,
+					     int id,
+                                             const Network *network);
+  ConcreteParasiticNode *findParasiticNode(const Pin *pin) const;
+  ConcreteParasiticNode *ensureParasiticNode(const Pin *pin,
+                                             const Network *network);
+  virtual float capacitance() const;
+  ParasiticNodeSeq nodes() const;
+  void disconnectPin(const Pin *pin,
+		     const Net *net,
+                     const Network *network);
+  ParasiticResistorSeq resistors() const;
+  void makeResistor(size_t id,
+                    float res,
+                    ConcreteParasiticNode *node1,
+                    ConcreteParasiticNode *node2);
+  ParasiticCapacitorSeq capacitors() const;
+  void makeCapacitor(size_t id,
+                     float cap,
+                     ConcreteParasiticNode *node1,
+                     ConcreteParasiticNode *node2);
+  virtual PinSet unannotatedLoads(const Pin *drvr_pin,
+                                  const Parasitics *parasitics) const;
+
+private:
+  void unannotatedLoads(ParasiticNode *node,
+                        ParasiticResistor *from_res,
+                        PinSet &loads,
+                        ParasiticNodeSet &visited_nodes,
+                        ParasiticResistorSet &loop_resistors,
+                        ParasiticNodeResistorMap &resistor_map,
+                        const Parasitics *parasitics) const;
+
+  const Net *net_;
+  ConcreteParasiticSubNodeMap sub_nodes_;
+  ConcreteParasiticPinNodeMap pin_nodes_;
+  // Storage for sub_nodes_ and pin_nodes_.
+  ConcreteParasiticArena<ConcreteParasiticNode> nodes_;
+  ConcreteParasiticArena<ConcreteParasiticResistor> resistors_;
+  ConcreteParasiticArena<ConcreteParasiticCapacitor> capacitors_;
+  unsigned max_node_id_:31;
+  bool includes_pin_caps_:1;
+};
+
 } // namespace
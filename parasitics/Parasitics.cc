@@ -39,10 +39,16 @@
 namespace sta {
 
 Parasitics::Parasitics(StaState *sta) :
-  StaState(sta)
+  StaState(sta),
+  reduced_model_cache_(makeReducedModelCache())
 {
 }
 
+Parasitics::~Parasitics()
+{
+  deleteReducedModelCache(reduced_model_cache_);
+}
+
 void
 Parasitics::report(const Parasitic *parasitic) const
 {
@@ -187,7 +193,8 @@ Parasitics::reduceToPiElmore(const Parasitic *parasitic,
                              const ParasiticAnalysisPt *ap)
 {
   return sta::reduceToPiElmore(parasitic, drvr_pin, rf, ap->couplingCapFactor(),
-                               corner, cnst_min_max, ap, this);
+                               corner, cnst_min_max, ap,
+                               reduced_model_cache_, this);
 }
 
 Parasitic *
@@ -200,8 +207,8 @@ Parasitics::reduceToPiPoleResidue2(const Parasitic *parasitic,
 {
   return sta::reduceToPiPoleResidue2(parasitic, drvr_pin, rf,
                                      ap->couplingCapFactor(),
-                                     corner, cnst_min_max,
-                                     ap, this);
+                                     corner, cnst_min_max, ap,
+                                     reduced_model_cache_, this);
 }
 
 ////////////////////////////////////////////////////////////////
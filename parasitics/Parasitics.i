@@ -59,6 +59,13 @@ report_parasitic_annotation_cmd(bool report_unannotated,
   Sta::sta()->reportParasiticAnnotation(report_unannotated, corner);
 }
 
+void
+reduce_parasitics_cmd(const Corner *corner,
+                      const MinMaxAll *min_max)
+{
+  Sta::sta()->reduceParasitics(corner, min_max);
+}
+
 FloatSeq
 find_pi_elmore(Pin *drvr_pin,
 	       RiseFall *rf,
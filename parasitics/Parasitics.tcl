@@ -78,6 +78,18 @@ proc_redirect report_parasitic_annotation {
   report_parasitic_annotation_cmd $report_unannotated [sta::cmd_corner]
 }
 
+define_cmd_args "reduce_parasitics" {[-corner corner] [-min] [-max]}
+
+proc reduce_parasitics { args } {
+  parse_key_args "reduce_parasitics" args \
+    keys {-corner} flags {-min -max}
+  check_argc_eq0 "reduce_parasitics" $args
+
+  set corner [parse_corner_or_all keys]
+  set min_max [parse_min_max_all_flags flags]
+  reduce_parasitics_cmd $corner $min_max
+}
+
 # set_pi_model [-min] [-max] drvr_pin c2 rpi c1
 proc set_pi_model { args } {
   parse_key_args "set_pi_model" args keys {} flags {-max -min}
@@ -24,6 +24,12 @@
 
 #include "ReduceParasitics.hh"
 
+#include <atomic>
+#include <cstring>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "Error.hh"
 #include "Debug.hh"
 #include "MinMax.hh"
@@ -32,6 +38,7 @@
 #include "Sdc.hh"
 #include "Corner.hh"
 #include "Parasitics.hh"
+#include "Mutex.hh"
 
 namespace sta {
 
@@ -42,10 +49,150 @@ typedef Map<ParasiticResistor*, double> ResistorCurrentMap;
 typedef Set<ParasiticResistor*> ParasiticResistorSet;
 typedef Set<ParasiticNode*> ParasiticNodeSet;
 
+// Reduced models are shared between reductions of a parasitic network
+// with the same values as seen from the driver, such as the rise and
+// fall reductions when load pin capacitances do not depend on rise/fall.
+// The values traversed are kept so hash collisions do not share models.
+class ReducedModelKey
+{
+public:
+  bool operator==(const ReducedModelKey &key) const
+  { return hash1 == key.hash1
+      && hash2 == key.hash2
+      && values == key.values; }
+
+  uint64_t hash1;
+  uint64_t hash2;
+  std::vector<uint32_t> values;
+};
+
+class ReducedModelKeyHash
+{
+public:
+  size_t operator()(const ReducedModelKey &key) const { return key.hash1; }
+};
+
+// Elmore or pole/residue model for one load pin.
+class ReducedLoadModel
+{
+public:
+  bool exists;
+  float elmore;
+  int pole_count;
+  ComplexFloat poles[2];
+  ComplexFloat residues[2];
+};
+
+typedef std::vector<ReducedLoadModel> ReducedLoadModelSeq;
+
+class ReducedModelTable
+{
+public:
+  // Per load models in fingerprint load order.
+  const ReducedLoadModelSeq *find(const ReducedModelKey &key);
+  void insert(const ReducedModelKey &key,
+              ReducedLoadModelSeq &&loads);
+  void clear();
+  size_t hits() const { return hits_; }
+  size_t misses() const { return misses_; }
+
+private:
+  // Reducers only write the cache on a miss, so lookups share the lock.
+  std::shared_mutex lock_;
+  std::unordered_map<ReducedModelKey, ReducedLoadModelSeq,
+                     ReducedModelKeyHash> models_;
+  // Key values in models_.
+  size_t value_count_ = 0;
+  std::atomic<size_t> hits_{0};
+  std::atomic<size_t> misses_{0};
+  // Bound memory on large designs.
+  static constexpr size_t model_count_max_ = 1 << 20;
+  static constexpr size_t value_count_max_ = 1 << 24;
+};
+
+const ReducedLoadModelSeq *
+ReducedModelTable::find(const ReducedModelKey &key)
+{
+  SharedLockGuard lock(lock_);
+  auto itr = models_.find(key);
+  if (itr == models_.end()) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  else {
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    // Entries are not erased while reducing so the reference is stable.
+    return &itr->second;
+  }
+}
+
+void
+ReducedModelTable::insert(const ReducedModelKey &key,
+                          ReducedLoadModelSeq &&loads)
+{
+  UniqueLockGuard lock(lock_);
+  if (models_.size() < model_count_max_
+      && value_count_ + key.values.size() <= value_count_max_
+      && models_.emplace(key, std::move(loads)).second)
+    value_count_ += key.values.size();
+}
+
+void
+ReducedModelTable::clear()
+{
+  UniqueLockGuard lock(lock_);
+  if (!models_.empty()) {
+    models_.clear();
+    value_count_ = 0;
+  }
+}
+
+// Reduced models are only shared between reductions of the same
+// parasitic network (the network serial is part of the key), so
+// other networks never see models computed from different values.
+class ReducedModelCache
+{
+public:
+  ReducedModelTable elmore;
+  ReducedModelTable pole_residue;
+};
+
+ReducedModelCache *
+makeReducedModelCache()
+{
+  return new ReducedModelCache;
+}
+
+void
+deleteReducedModelCache(ReducedModelCache *cache)
+{
+  delete cache;
+}
+
+void
+clearReducedModelCache(ReducedModelCache *cache)
+{
+  cache->elmore.clear();
+  cache->pole_residue.clear();
+}
+
+void
+reducedModelCacheStats(const ReducedModelCache *cache,
+                       // Return values.
+                       size_t &hits,
+                       size_t &misses)
+{
+  hits = cache->elmore.hits() + cache->pole_residue.hits();
+  misses = cache->elmore.misses() + cache->pole_residue.misses();
+}
+
+////////////////////////////////////////////////////////////////
+
 class ReduceToPi : public StaState
 {
 public:
-  ReduceToPi(StaState *sta);
+  ReduceToPi(ReducedModelCache *cache,
+             StaState *sta);
   void reduceToPi(const Parasitic *parasitic_network,
                   const Pin *drvr_pin,
 		  ParasiticNode *drvr_node,
@@ -60,6 +207,9 @@ public:
   bool pinCapsOneValue() { return pin_caps_one_value_; }
 
 protected:
+  const ReducedLoadModelSeq *findReducedModel(ReducedModelTable &cache);
+  void fingerprint(uint32_t value);
+  void fingerprint(double value);
   void reducePiDfs(const Pin *drvr_pin,
 		   ParasiticNode *node,
 		   ParasiticResistor *from_res,
@@ -79,6 +229,7 @@ protected:
   bool isLoopResistor(ParasiticResistor *resistor);
   void markLoopResistor(ParasiticResistor *resistor);
 
+  ReducedModelCache *cache_;
   bool includes_pin_caps_;
   float coupling_cap_multiplier_;
   const RiseFall *rf_;
@@ -92,15 +243,25 @@ protected:
   ParasiticNodeValueMap node_values_;
   ParasiticResistorSet loop_resistors_;
   bool pin_caps_one_value_;
+  // Fingerprint of the network tree traversed by reducePiDfs.
+  ReducedModelKey fingerprint_;
+  // Networks with resistor loops are not shared.
+  bool fingerprint_valid_;
+  // Load pins in traversal order.
+  PinSeq fingerprint_loads_;
 };
 
-ReduceToPi::ReduceToPi(StaState *sta) :
+ReduceToPi::ReduceToPi(ReducedModelCache *cache,
+                       StaState *sta) :
   StaState(sta),
+  cache_(cache),
   coupling_cap_multiplier_(1.0),
   rf_(nullptr),
   corner_(nullptr),
   min_max_(nullptr),
-  pin_caps_one_value_(true)
+  pin_caps_one_value_(true),
+  fingerprint_{0xcbf29ce484222325ull, 0x9e3779b97f4a7c15ull, {}},
+  fingerprint_valid_(true)
 {
 }
 
@@ -129,6 +290,9 @@ ReduceToPi::reduceToPi(const Parasitic *parasitic_network,
   ap_ = ap;
   resistor_map_ = parasitics_->parasiticNodeResistorMap(parasitic_network);
   capacitor_map_ = parasitics_->parasiticNodeCapacitorMap(parasitic_network);
+  size_t serial = parasitics_->serial(parasitic_network);
+  fingerprint(static_cast<uint32_t>(serial));
+  fingerprint(static_cast<uint32_t>(static_cast<uint64_t>(serial) >> 32));
 
   double y1, y2, y3, dcap;
   double max_resistance = 0.0;
@@ -151,6 +315,40 @@ ReduceToPi::reduceToPi(const Parasitic *parasitic_network,
              c2, rpi, c1, max_resistance);
 }
 
+const ReducedLoadModelSeq *
+ReduceToPi::findReducedModel(ReducedModelTable &cache)
+{
+  if (fingerprint_valid_) {
+    const ReducedLoadModelSeq *loads = cache.find(fingerprint_);
+    if (loads && loads->size() == fingerprint_loads_.size()) {
+      debugPrint(debug_, "parasitic_reduce", 2, " reuse reduced model");
+      return loads;
+    }
+  }
+  return nullptr;
+}
+
+void
+ReduceToPi::fingerprint(uint32_t value)
+{
+  fingerprint_.values.push_back(value);
+  // FNV-1a and a multiply/rotate mix make an independent 128 bit hash.
+  fingerprint_.hash1 = (fingerprint_.hash1 ^ value) * 0x100000001b3ull;
+  uint64_t h2 = fingerprint_.hash2 + value * 0xc2b2ae3d27d4eb4full;
+  fingerprint_.hash2 = ((h2 << 31) | (h2 >> 33)) * 0x9e3779b97f4a7c15ull;
+}
+
+// Values are not rounded, so networks only share reduced models when
+// the models would be computed from the same values.
+void
+ReduceToPi::fingerprint(double value)
+{
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  fingerprint(static_cast<uint32_t>(bits));
+  fingerprint(static_cast<uint32_t>(bits >> 32));
+}
+
 // Find admittance moments.
 void
 ReduceToPi::reducePiDfs(const Pin *drvr_pin,
@@ -175,6 +373,13 @@ ReduceToPi::reducePiDfs(const Pin *drvr_pin,
   y2 = y3 = 0.0;
   max_resistance = max(max_resistance, src_resistance);
 
+  const Pin *pin = parasitics_->pin(node);
+  bool is_load = pin && network_->isLoad(pin);
+  if (is_load)
+    fingerprint_loads_.push_back(pin);
+  fingerprint(uint32_t(is_load ? 1 : 2));
+  fingerprint(double(dwn_cap));
+
   visit(node);
   ParasiticResistorSeq &resistors = resistor_map_[node];
   for (ParasiticResistor *resistor : resistors) {
@@ -188,9 +393,11 @@ ReduceToPi::reducePiDfs(const Pin *drvr_pin,
           debugPrint(debug_, "parasitic_reduce", 2, " loop detected thru resistor %zu",
                      parasitics_->id(resistor));
           markLoopResistor(resistor);
+          fingerprint_valid_ = false;
         }
         else {
           double r = parasitics_->value(resistor);
+          fingerprint(r);
           double yd1, yd2, yd3, dcap;
           reducePiDfs(drvr_pin, onode, resistor, src_resistance + r,
                       yd1, yd2, yd3, dcap, max_resistance);
@@ -207,6 +414,7 @@ ReduceToPi::reducePiDfs(const Pin *drvr_pin,
 
   setDownstreamCap(node, dwn_cap);
   leave(node);
+  fingerprint(uint32_t(3));
   debugPrint(debug_, "parasitic_reduce", 3,
              " node %s y1=%.3g y2=%.3g y3=%.3g cap=%.3g",
              parasitics_->name(node), y1, y2, y3, dwn_cap);
@@ -280,7 +488,8 @@ ReduceToPi::downstreamCap(ParasiticNode *node)
 class ReduceToPiElmore : public ReduceToPi
 {
 public:
-  ReduceToPiElmore(StaState *sta);
+  ReduceToPiElmore(ReducedModelCache *cache,
+                   StaState *sta);
   Parasitic *makePiElmore(const Parasitic *parasitic_network,
                           const Pin *drvr_pin,
                           ParasiticNode *drvr_node,
@@ -294,6 +503,9 @@ public:
 		       ParasiticResistor *from_res,
 		       double elmore,
 		       Parasitic *pi_elmore);
+
+private:
+  void saveReducedModel(const Parasitic *pi_elmore);
 };
 
 Parasitic *
@@ -304,6 +516,7 @@ reduceToPiElmore(const Parasitic *parasitic_network,
 		 const Corner *corner,
 		 const MinMax *min_max,
 		 const ParasiticAnalysisPt *ap,
+		 ReducedModelCache *cache,
 		 StaState *sta)
 {
   Parasitics *parasitics = sta->parasitics();
@@ -314,7 +527,7 @@ reduceToPiElmore(const Parasitic *parasitic_network,
                sta->network()->pathName(drvr_pin),
                rf->to_string().c_str(),
                min_max->to_string().c_str());
-    ReduceToPiElmore reducer(sta);
+    ReduceToPiElmore reducer(cache, sta);
     return reducer.makePiElmore(parasitic_network, drvr_pin, drvr_node,
                                 coupling_cap_factor, rf, corner,
                                 min_max, ap);
@@ -322,8 +535,9 @@ reduceToPiElmore(const Parasitic *parasitic_network,
   return nullptr;
 }
 
-ReduceToPiElmore::ReduceToPiElmore(StaState *sta) :
-  ReduceToPi(sta)
+ReduceToPiElmore::ReduceToPiElmore(ReducedModelCache *cache,
+                                   StaState *sta) :
+  ReduceToPi(cache, sta)
 {
 }
 
@@ -343,10 +557,34 @@ ReduceToPiElmore::makePiElmore(const Parasitic *parasitic_network,
   Parasitic *pi_elmore = parasitics_->makePiElmore(drvr_pin, rf, ap,
 						   c2, rpi, c1);
   parasitics_->setIsReducedParasiticNetwork(pi_elmore, true);
-  reduceElmoreDfs(drvr_pin, drvr_node, 0, 0.0, pi_elmore);
+  const ReducedLoadModelSeq *loads = findReducedModel(cache_->elmore);
+  if (loads) {
+    for (size_t i = 0; i < loads->size(); i++) {
+      const ReducedLoadModel &load = (*loads)[i];
+      if (load.exists)
+        parasitics_->setElmore(pi_elmore, fingerprint_loads_[i], load.elmore);
+    }
+  }
+  else {
+    reduceElmoreDfs(drvr_pin, drvr_node, 0, 0.0, pi_elmore);
+    if (fingerprint_valid_)
+      saveReducedModel(pi_elmore);
+  }
   return pi_elmore;
 }
 
+void
+ReduceToPiElmore::saveReducedModel(const Parasitic *pi_elmore)
+{
+  ReducedLoadModelSeq loads(fingerprint_loads_.size());
+  for (size_t i = 0; i < fingerprint_loads_.size(); i++) {
+    ReducedLoadModel &load = loads[i];
+    parasitics_->findElmore(pi_elmore, fingerprint_loads_[i],
+                            load.elmore, load.exists);
+  }
+  cache_->elmore.insert(fingerprint_, std::move(loads));
+}
+
 // Find elmore delays on 2nd DFS search using downstream capacitances
 // set by reducePiDfs.
 void
@@ -385,12 +623,14 @@ ReduceToPiElmore::reduceElmoreDfs(const Pin *drvr_pin,
 class ReduceToPiPoleResidue2 : public ReduceToPi
 {
 public:
-  ReduceToPiPoleResidue2(StaState *sta);
+  ReduceToPiPoleResidue2(ReducedModelCache *cache,
+                         StaState *sta);
   ~ReduceToPiPoleResidue2();
-  void findPolesResidues(const Parasitic *parasitic_network,
-                         Parasitic *pi_pole_residue,
-			 const Pin *drvr_pin,
-			 ParasiticNode *drvr_node);
+  // Return the number of loads with pole/residue models.
+  size_t findPolesResidues(const Parasitic *parasitic_network,
+                           Parasitic *pi_pole_residue,
+                           const Pin *drvr_pin,
+                           ParasiticNode *drvr_node);
   Parasitic *makePiPoleResidue2(const Parasitic *parasitic_network,
                                 const Pin *drvr_pin,
                                 ParasiticNode *drvr_node,
@@ -421,6 +661,9 @@ private:
   double current(ParasiticResistor *res);
   void setCurrent(ParasiticResistor *res,
 		  double i);
+  void saveReducedModel(const Parasitic *pi_pole_residue);
+  void setReducedModel(Parasitic *pi_pole_residue,
+                       const ReducedLoadModelSeq &loads);
   void findPolesResidues(Parasitic *pi_pole_residue,
 			 const Pin *drvr_pin,
 			 const Pin *load_pin,
@@ -431,8 +674,9 @@ private:
   ParasiticNodeValueMap *moments_;
 };
 
-ReduceToPiPoleResidue2::ReduceToPiPoleResidue2(StaState *sta) :
-  ReduceToPi(sta),
+ReduceToPiPoleResidue2::ReduceToPiPoleResidue2(ReducedModelCache *cache,
+                                               StaState *sta) :
+  ReduceToPi(cache, sta),
   moments_(nullptr)
 {
 }
@@ -455,6 +699,7 @@ reduceToPiPoleResidue2(const Parasitic *parasitic_network,
 		       const Corner *corner,
 		       const MinMax *min_max,
 		       const ParasiticAnalysisPt *ap,
+		       ReducedModelCache *cache,
 		       StaState *sta)
 {
   Parasitics *parasitics = sta->parasitics();
@@ -463,7 +708,7 @@ reduceToPiPoleResidue2(const Parasitic *parasitic_network,
   if (drvr_node) {
     debugPrint(sta->debug(), "parasitic_reduce", 1, "Reduce driver %s",
                sta->network()->pathName(drvr_pin));
-    ReduceToPiPoleResidue2 reducer(sta);
+    ReduceToPiPoleResidue2 reducer(cache, sta);
     return reducer.makePiPoleResidue2(parasitic_network, drvr_pin, drvr_node,
                                       coupling_cap_factor, rf,
                                       corner, min_max, ap);
@@ -489,16 +734,65 @@ ReduceToPiPoleResidue2::makePiPoleResidue2(const Parasitic *parasitic_network,
 							      rf, ap,
 							      c2, rpi, c1);
   parasitics_->setIsReducedParasiticNetwork(pi_pole_residue, true);
-  findPolesResidues(parasitic_network, pi_pole_residue, drvr_pin, drvr_node);
+  const ReducedLoadModelSeq *loads = findReducedModel(cache_->pole_residue);
+  if (loads)
+    setReducedModel(pi_pole_residue, *loads);
+  else {
+    size_t load_count = findPolesResidues(parasitic_network, pi_pole_residue,
+                                          drvr_pin, drvr_node);
+    // Loads that are not connected to the driver are not in the fingerprint.
+    if (fingerprint_valid_
+        && load_count == fingerprint_loads_.size())
+      saveReducedModel(pi_pole_residue);
+  }
   return pi_pole_residue;
 }
 
+void
+ReduceToPiPoleResidue2::saveReducedModel(const Parasitic *pi_pole_residue)
+{
+  ReducedLoadModelSeq loads(fingerprint_loads_.size());
+  for (size_t i = 0; i < fingerprint_loads_.size(); i++) {
+    ReducedLoadModel &load = loads[i];
+    const Parasitic *pole_residue =
+      parasitics_->findPoleResidue(pi_pole_residue, fingerprint_loads_[i]);
+    load.exists = pole_residue != nullptr;
+    load.pole_count = 0;
+    if (pole_residue) {
+      load.pole_count = parasitics_->poleResidueCount(pole_residue);
+      for (int j = 0; j < load.pole_count; j++)
+        parasitics_->poleResidue(pole_residue, j,
+                                 load.poles[j], load.residues[j]);
+    }
+  }
+  cache_->pole_residue.insert(fingerprint_, std::move(loads));
+}
+
+void
+ReduceToPiPoleResidue2::setReducedModel(Parasitic *pi_pole_residue,
+                                        const ReducedLoadModelSeq &loads)
+{
+  for (size_t i = 0; i < loads.size(); i++) {
+    const ReducedLoadModel &load = loads[i];
+    if (load.exists) {
+      ComplexFloatSeq *poles = new ComplexFloatSeq(load.pole_count);
+      ComplexFloatSeq *residues = new ComplexFloatSeq(load.pole_count);
+      for (int j = 0; j < load.pole_count; j++) {
+        (*poles)[j] = load.poles[j];
+        (*residues)[j] = load.residues[j];
+      }
+      parasitics_->setPoleResidue(pi_pole_residue, fingerprint_loads_[i],
+                                  poles, residues);
+    }
+  }
+}
+
 ReduceToPiPoleResidue2::~ReduceToPiPoleResidue2()
 {
   delete [] moments_;
 }
 
-void
+size_t
 ReduceToPiPoleResidue2::findPolesResidues(const Parasitic *parasitic_network,
                                           Parasitic *pi_pole_residue,
 					  const Pin *drvr_pin,
@@ -507,6 +801,7 @@ ReduceToPiPoleResidue2::findPolesResidues(const Parasitic *parasitic_network,
   moments_ = new ParasiticNodeValueMap[4];
   findMoments(drvr_pin, drvr_node, 4);
 
+  size_t load_count = 0;
   PinConnectedPinIterator *pin_iter = network_->connectedPinIterator(drvr_pin);
   while (pin_iter->hasNext()) {
     const Pin *pin = pin_iter->next();
@@ -515,10 +810,12 @@ ReduceToPiPoleResidue2::findPolesResidues(const Parasitic *parasitic_network,
         parasitics_->findParasiticNode(parasitic_network, pin);
       if (load_node) {
 	findPolesResidues(pi_pole_residue, drvr_pin, pin, load_node);
+        load_count++;
       }
     }
   }
   delete pin_iter;
+  return load_count;
 }
 
 void
@@ -32,6 +32,7 @@ namespace sta {
 class Corner;
 class Parasitic;
 class ParasiticAnalysisPt;
+class ReducedModelCache;
 class StaState;
 
 // Reduce parasitic network to pi elmore model for drvr_pin.
@@ -43,6 +44,7 @@ reduceToPiElmore(const Parasitic *parasitic_network,
 		 const Corner *corner,
 		 const MinMax *min_max,
 		 const ParasiticAnalysisPt *ap,
+		 ReducedModelCache *cache,
 		 StaState *sta);
 
 // Reduce parasitic network to pi and 2nd order pole/residue models
@@ -55,6 +57,21 @@ reduceToPiPoleResidue2(const Parasitic *parasitic_network,
 		       const Corner *corner,
 		       const MinMax *min_max,
 		       const ParasiticAnalysisPt *ap,
+		       ReducedModelCache *cache,
 		       StaState *sta);
 
+// Reduced models are shared by reductions of a parasitic network
+// with identical fingerprints.
+ReducedModelCache *
+makeReducedModelCache();
+void
+deleteReducedModelCache(ReducedModelCache *cache);
+void
+clearReducedModelCache(ReducedModelCache *cache);
+void
+reducedModelCacheStats(const ReducedModelCache *cache,
+                       // Return values.
+                       size_t &hits,
+                       size_t &misses);
+
 } // namespace
@@ -0,0 +1,475 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+
+#include "power/ActivityDb.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Error.hh"
+#include "Debug.hh"
+#include "Stats.hh"
+#include "Report.hh"
+#include "Network.hh"
+#include "Power.hh"
+#include "Sta.hh"
+
+namespace sta {
+
+using std::string;
+using std::vector;
+
+static constexpr char activity_db_magic[8] = {'S','T','A','A','C','T','D','B'};
+static constexpr uint32_t activity_db_version = 2;
+static constexpr uint32_t activity_db_byte_order = 0x01020304;
+static constexpr uint32_t activity_db_no_interval = UINT32_MAX;
+
+struct ActivityDbHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint64_t pin_count;
+  uint64_t interval_pin_count;
+  uint64_t interval_count;
+  double interval;              // seconds
+  double end_time;              // seconds
+  uint64_t records_offset;
+  uint64_t names_offset;
+  uint64_t names_size;
+  uint64_t intervals_offset;
+};
+
+struct ActivityDbRecord
+{
+  uint64_t name_offset;
+  uint32_t name_length;
+  float density;
+  float duty;
+  uint32_t origin;              // PwrActivityOrigin
+  uint32_t interval_index;      // activity_db_no_interval if none
+  uint32_t pad;
+};
+
+static uint64_t
+alignUp8(uint64_t size)
+{
+  return (size + 7) & ~static_cast<uint64_t>(7);
+}
+
+////////////////////////////////////////////////////////////////
+
+class ActivityDbWriter : public StaState
+{
+public:
+  ActivityDbWriter(const char *filename,
+                   FILE *stream,
+                   Sta *sta);
+  void write();
+
+private:
+  void findPins();
+  void writeHeader();
+  void writeRecords();
+  void writeNames();
+  void writeIntervals();
+  void writeBytes(const void *bytes,
+                  size_t size);
+  void writePad(size_t size);
+
+  const char *filename_;
+  FILE *stream_;
+  Power *power_;
+  // Pin names sorted for the lookup index.
+  vector<std::pair<string, const Pin*>> pin_names_;
+  uint64_t names_size_;
+};
+
+void
+writeActivityDb(const char *filename,
+                Sta *sta)
+{
+  FILE *stream = fopen(filename, "wb");
+  if (stream) {
+    ActivityDbWriter writer(filename, stream, sta);
+    writer.write();
+    fclose(stream);
+  }
+  else
+    throw FileNotWritable(filename);
+}
+
+ActivityDbWriter::ActivityDbWriter(const char *filename,
+                                   FILE *stream,
+                                   Sta *sta) :
+  StaState(sta),
+  filename_(filename),
+  stream_(stream),
+  power_(sta->power()),
+  names_size_(0)
+{
+}
+
+void
+ActivityDbWriter::write()
+{
+  Stats stats(debug_, report_);
+  findPins();
+  writeHeader();
+  writeRecords();
+  writeNames();
+  writeIntervals();
+  stats.report("Write activity db");
+  report_->reportLine("Wrote %zu pin activities.", pin_names_.size());
+}
+
+void
+ActivityDbWriter::findPins()
+{
+  const PwrActivityMap &user_activities = power_->userActivities();
+  const PwrIntervalActivities &intervals = power_->intervalActivities();
+  pin_names_.reserve(user_activities.size());
+  for (const auto& [pin, activity] : user_activities)
+    pin_names_.emplace_back(sdc_network_->pathName(pin), pin);
+  // Interval pins without an average activity.
+  for (const Pin *pin : intervals.pins()) {
+    if (user_activities.find(pin) == user_activities.end())
+      pin_names_.emplace_back(sdc_network_->pathName(pin), pin);
+  }
+  sort(pin_names_.begin(), pin_names_.end());
+  for (const auto& [name, pin] : pin_names_)
+    names_size_ += name.size() + 1;
+}
+
+void
+ActivityDbWriter::writeHeader()
+{
+  const PwrIntervalActivities &intervals = power_->intervalActivities();
+  ActivityDbHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, activity_db_magic, sizeof(header.magic));
+  header.version = activity_db_version;
+  header.byte_order = activity_db_byte_order;
+  header.pin_count = pin_names_.size();
+  header.interval_pin_count = intervals.pinCount();
+  header.interval_count = intervals.intervalCount();
+  header.interval = intervals.interval();
+  header.end_time = intervals.endTime();
+  header.records_offset = sizeof(ActivityDbHeader);
+  header.names_offset = header.records_offset
+    + header.pin_count * sizeof(ActivityDbRecord);
+  header.names_size = names_size_;
+  header.intervals_offset = header.names_offset + alignUp8(names_size_);
+  writeBytes(&header, sizeof(header));
+}
+
+void
+ActivityDbWriter::writeRecords()
+{
+  const PwrActivityMap &user_activities = power_->userActivities();
+  const PwrIntervalActivities &intervals = power_->intervalActivities();
+  uint64_t name_offset = 0;
+  for (const auto& [name, pin] : pin_names_) {
+    ActivityDbRecord record;
+    memset(&record, 0, sizeof(record));
+    record.name_offset = name_offset;
+    record.name_length = name.size();
+    auto activity_itr = user_activities.find(pin);
+    if (activity_itr != user_activities.end()) {
+      const PwrActivity &activity = activity_itr->second;
+      record.density = activity.density();
+      record.duty = activity.duty();
+      record.origin = static_cast<uint32_t>(activity.origin());
+    }
+    else
+      record.origin = static_cast<uint32_t>(PwrActivityOrigin::unknown);
+    size_t pin_index;
+    if (intervals.findPinIndex(pin, pin_index))
+      record.interval_index = pin_index;
+    else
+      record.interval_index = activity_db_no_interval;
+    writeBytes(&record, sizeof(record));
+    name_offset += name.size() + 1;
+  }
+}
+
+void
+ActivityDbWriter::writeNames()
+{
+  for (const auto& [name, pin] : pin_names_)
+    writeBytes(name.c_str(), name.size() + 1);
+  writePad(alignUp8(names_size_) - names_size_);
+}
+
+void
+ActivityDbWriter::writeIntervals()
+{
+  const PwrIntervalActivities &intervals = power_->intervalActivities();
+  size_t pin_count = intervals.pinCount();
+  if (pin_count > 0) {
+    for (size_t i = 0; i < intervals.intervalCount(); i++)
+      writeBytes(intervals.densities(i).data(), pin_count * sizeof(float));
+    for (size_t i = 0; i < intervals.intervalCount(); i++)
+      writeBytes(intervals.duties(i).data(), pin_count * sizeof(float));
+  }
+}
+
+void
+ActivityDbWriter::writeBytes(const void *bytes,
+                             size_t size)
+{
+  if (fwrite(bytes, 1, size, stream_) != size)
+    throw FileNotWritable(filename_);
+}
+
+void
+ActivityDbWriter::writePad(size_t size)
+{
+  static const char pad[8] = {0};
+  writeBytes(pad, size);
+}
+
+////////////////////////////////////////////////////////////////
+
+// Read only view of the file contents.
+class ActivityDbFile
+{
+public:
+  ActivityDbFile(const char *filename);
+  ~ActivityDbFile();
+  const char *data() const { return data_; }
+  size_t size() const { return size_; }
+
+private:
+  const char *filename_;
+  const char *data_;
+  size_t size_;
+#ifdef _WIN32
+  vector<char> buffer_;
+#endif
+};
+
+#ifdef _WIN32
+
+ActivityDbFile::ActivityDbFile(const char *filename) :
+  filename_(filename),
+  data_(nullptr),
+  size_(0)
+{
+  FILE *stream = fopen(filename, "rb");
+  if (stream == nullptr)
+    throw FileNotReadable(filename);
+  fseek(stream, 0, SEEK_END);
+  size_ = ftell(stream);
+  fseek(stream, 0, SEEK_SET);
+  buffer_.resize(size_);
+  size_t read_size = fread(buffer_.data(), 1, size_, stream);
+  fclose(stream);
+  if (read_size != size_)
+    throw FileNotReadable(filename);
+  data_ = buffer_.data();
+}
+
+ActivityDbFile::~ActivityDbFile()
+{
+}
+
+#else
+
+ActivityDbFile::ActivityDbFile(const char *filename) :
+  filename_(filename),
+  data_(nullptr),
+  size_(0)
+{
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0)
+    throw FileNotReadable(filename);
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    close(fd);
+    throw FileNotReadable(filename);
+  }
+  size_ = file_stat.st_size;
+  if (size_ > 0) {
+    void *addr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+      close(fd);
+      throw FileNotReadable(filename);
+    }
+    // The records and names are read sequentially.
+    madvise(addr, size_, MADV_SEQUENTIAL);
+    data_ = static_cast<const char*>(addr);
+  }
+  // The mapping stays valid after the descriptor is closed.
+  close(fd);
+}
+
+ActivityDbFile::~ActivityDbFile()
+{
+  if (data_)
+    munmap(const_cast<char*>(data_), size_);
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////
+
+class ActivityDbReader : public StaState
+{
+public:
+  ActivityDbReader(const char *filename,
+                   Sta *sta);
+  void read();
+
+private:
+  bool checkHeader(const ActivityDbHeader *header);
+  void setActivities(const ActivityDbHeader *header);
+
+  const char *filename_;
+  ActivityDbFile file_;
+  Power *power_;
+  size_t annotated_count_;
+  size_t missing_count_;
+};
+
+void
+readActivityDb(const char *filename,
+               Sta *sta)
+{
+  ActivityDbReader reader(filename, sta);
+  reader.read();
+}
+
+ActivityDbReader::ActivityDbReader(const char *filename,
+                                   Sta *sta) :
+  StaState(sta),
+  filename_(filename),
+  file_(filename),
+  power_(sta->power()),
+  annotated_count_(0),
+  missing_count_(0)
+{
+}
+
+void
+ActivityDbReader::read()
+{
+  Stats stats(debug_, report_);
+  const ActivityDbHeader *header =
+    reinterpret_cast<const ActivityDbHeader*>(file_.data());
+  if (checkHeader(header))
+    setActivities(header);
+  stats.report("Read activity db");
+  if (missing_count_ > 0)
+    report_->warn(1463, "%zu pins in %s not found.", missing_count_, filename_);
+  report_->reportLine("Annotated %zu pin activities.", annotated_count_);
+}
+
+bool
+ActivityDbReader::checkHeader(const ActivityDbHeader *header)
+{
+  size_t size = file_.size();
+  if (size < sizeof(ActivityDbHeader)
+      || memcmp(header->magic, activity_db_magic, sizeof(header->magic)) != 0) {
+    report_->error(1460, "%s is not an activity database.", filename_);
+    return false;
+  }
+  if (header->version != activity_db_version
+      || header->byte_order != activity_db_byte_order) {
+    report_->error(1461, "%s activity database version or byte order not supported.",
+                   filename_);
+    return false;
+  }
+  uint64_t intervals_size = header->interval_count * header->interval_pin_count
+    * sizeof(float) * 2;
+  if (header->records_offset + header->pin_count * sizeof(ActivityDbRecord)
+      > header->names_offset
+      || header->names_offset + header->names_size > header->intervals_offset
+      || header->intervals_offset + intervals_size > size) {
+    report_->error(1462, "%s activity database is truncated.", filename_);
+    return false;
+  }
+  return true;
+}
+
+void
+ActivityDbReader::setActivities(const ActivityDbHeader *header)
+{
+  const char *data = file_.data();
+  const ActivityDbRecord *records =
+    reinterpret_cast<const ActivityDbRecord*>(data + header->records_offset);
+  const char *names = data + header->names_offset;
+  const float *densities =
+    reinterpret_cast<const float*>(data + header->intervals_offset);
+  size_t interval_pin_count = header->interval_pin_count;
+  size_t interval_count = header->interval_count;
+  const float *duties = densities + interval_count * interval_pin_count;
+
+  PwrIntervalActivities &intervals = power_->intervalActivities();
+  intervals.clear();
+  if (interval_count > 0)
+    intervals.init(header->interval, interval_count, header->end_time);
+
+  PwrActivityOrigin unknown = PwrActivityOrigin::unknown;
+  for (size_t i = 0; i < header->pin_count; i++) {
+    const ActivityDbRecord &record = records[i];
+    if (record.name_offset + record.name_length >= header->names_size)
+      continue;
+    const char *pin_name = names + record.name_offset;
+    const Pin *pin = sdc_network_->findPin(pin_name);
+    if (pin) {
+      PwrActivityOrigin origin = (record.origin < static_cast<uint32_t>(unknown))
+        ? static_cast<PwrActivityOrigin>(record.origin)
+        : unknown;
+      if (origin != unknown)
+        power_->setUserActivity(pin, record.density, record.duty, origin);
+      if (record.interval_index < interval_pin_count) {
+        size_t pin_index = intervals.addPin(pin);
+        for (size_t j = 0; j < interval_count; j++) {
+          size_t offset = j * interval_pin_count + record.interval_index;
+          intervals.setActivity(pin_index, j, densities[offset], duties[offset]);
+        }
+      }
+      annotated_count_++;
+    }
+    else {
+      debugPrint(debug_, "read_activity_db", 1, "pin %s not found", pin_name);
+      missing_count_++;
+    }
+  }
+}
+
+} // namespace
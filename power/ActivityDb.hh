@@ -0,0 +1,50 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+
+#pragma once
+
+namespace sta {
+
+class Sta;
+
+// Binary activity database.
+// Pin activities annotated by read_vcd/read_saif/set_power_activity and
+// read_vcd -interval activities are saved keyed by hierarchical pin
+// name so one simulation parse can be reused by many power runs.
+//
+// File layout (native byte order, 8 byte aligned sections)
+//  header
+//  pin records sorted by pin name
+//  pin name string table (null terminated names)
+//  interval densities [interval][interval pin]
+//  interval duties [interval][interval pin]
+void
+writeActivityDb(const char *filename,
+                Sta *sta);
+void
+readActivityDb(const char *filename,
+               Sta *sta);
+
+} // namespace
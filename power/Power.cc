@@ -99,6 +99,7 @@ Power::Power(StaState *sta) :
   global_activity_(),
   input_activity_(),            // default set in ensureActivities()
   seq_activity_map_(100, SeqPinHash(network_), SeqPinEqual()),
+  activity_interval_(-1),
   activities_valid_(false),
   bdd_(sta)
 {
@@ -112,6 +113,7 @@ Power::clear()
   user_activity_map_.clear();
   seq_activity_map_.clear();
   activity_map_.clear();
+  interval_activities_.clear();
   activities_valid_ = false;
 }
 
@@ -179,6 +181,15 @@ Power::setUserActivity(const Pin *pin,
   activities_valid_ = false;
 }
 
+void
+Power::setUserActivities(const PwrPinActivitySeq &pin_activities)
+{
+  user_activity_map_.reserve(user_activity_map_.size() + pin_activities.size());
+  for (const auto& [pin, activity] : pin_activities)
+    user_activity_map_[pin] = activity;
+  activities_valid_ = false;
+}
+
 void
 Power::unsetUserActivity(const Pin *pin)
 {
@@ -394,6 +405,128 @@ Power::highestPowerInstances(size_t count,
 
 ////////////////////////////////////////////////////////////////
 
+void
+Power::intervalPower(const Corner *corner,
+                     // Return value.
+                     PowerResultSeq &interval_powers)
+{
+  interval_powers.clear();
+  if (!interval_activities_.empty()) {
+    ensureActivities();
+    Stats stats(debug_, report_);
+    size_t pin_count = interval_activities_.pinCount();
+    vector<float> switching_coefs(pin_count, 0.0);
+    PowerResult fixed;
+    InstanceSeq interval_insts;
+    LeafInstanceIterator *inst_iter = network_->leafInstanceIterator();
+    while (inst_iter->hasNext()) {
+      Instance *inst = inst_iter->next();
+      LibertyCell *cell = network_->libertyCell(inst);
+      if (cell) {
+        if (hasIntervalActivities(inst)) {
+          interval_insts.push_back(inst);
+          findIntervalSwitchingCoefficients(inst, cell, corner,
+                                            switching_coefs, fixed);
+        }
+        else {
+          PowerResult inst_power = power(inst, cell, corner);
+          fixed.incr(inst_power);
+        }
+      }
+    }
+    delete inst_iter;
+
+    size_t interval_count = interval_activities_.intervalCount();
+    interval_powers.resize(interval_count);
+    for (size_t i = 0; i < interval_count; i++) {
+      const vector<float> &densities = interval_activities_.densities(i);
+      double switching = 0.0;
+      for (size_t pin_index = 0; pin_index < pin_count; pin_index++)
+        switching += switching_coefs[pin_index] * densities[pin_index];
+      PowerResult &result = interval_powers[i];
+      result.incr(fixed);
+      result.incrSwitching(switching);
+      // Internal and leakage power depend on the duties of when
+      // conditions and the densities of related pins, so they are
+      // found with findActivity returning the interval activities.
+      activity_interval_ = i;
+      for (const Instance *inst : interval_insts) {
+        LibertyCell *cell = network_->libertyCell(inst);
+        findInternalPower(inst, cell, corner, result);
+        findLeakagePower(inst, cell, corner, result);
+      }
+      activity_interval_ = -1;
+    }
+    stats.report("Find interval power");
+  }
+}
+
+bool
+Power::hasIntervalActivities(const Instance *inst)
+{
+  bool has_activities = false;
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    const Pin *pin = pin_iter->next();
+    size_t pin_index;
+    if (interval_activities_.findPinIndex(pin, pin_index)) {
+      has_activities = true;
+      break;
+    }
+  }
+  delete pin_iter;
+  return has_activities;
+}
+
+// Find switching power per unit density for output pins with
+// interval activities. Switching power for outputs without interval
+// activities is accumulated in fixed.
+void
+Power::findIntervalSwitchingCoefficients(const Instance *inst,
+                                         LibertyCell *cell,
+                                         const Corner *corner,
+                                         // Return values.
+                                         vector<float> &switching_coefs,
+                                         PowerResult &fixed)
+{
+  const DcalcAnalysisPt *dcalc_ap = corner->findDcalcAnalysisPt(MinMax::max());
+  LibertyCell *corner_cell = cell->cornerCell(dcalc_ap);
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    const Pin *pin = pin_iter->next();
+    LibertyPort *port = network_->libertyPort(pin);
+    if (port && port->direction()->isAnyOutput()) {
+      float load_cap = graph_delay_calc_->loadCap(pin, dcalc_ap);
+      float volt = portVoltage(corner_cell, port, dcalc_ap);
+      float unit_switching = .5 * load_cap * volt * volt;
+      size_t pin_index;
+      if (interval_activities_.findPinIndex(pin, pin_index))
+        switching_coefs[pin_index] += unit_switching;
+      else
+        fixed.incrSwitching(unit_switching * findActivity(pin).density());
+    }
+  }
+  delete pin_iter;
+}
+
+// Activity of pin in activity_interval_.
+bool
+Power::findIntervalActivity(const Pin *pin,
+                            // Return value.
+                            PwrActivity &activity)
+{
+  size_t pin_index;
+  if (interval_activities_.findPinIndex(pin, pin_index)) {
+    activity.set(interval_activities_.density(pin_index, activity_interval_),
+                 interval_activities_.duty(pin_index, activity_interval_),
+                 PwrActivityOrigin::vcd);
+    return true;
+  }
+  return false;
+}
+
+////////////////////////////////////////////////////////////////
+
 class ActivitySrchPred : public SearchPredNonLatch2
 {
 public:
@@ -1287,8 +1420,12 @@ PwrActivity
 Power::findActivity(const Pin *pin)
 {
   Vertex *vertex = graph_->pinLoadVertex(pin);
+  PwrActivity interval_activity;
   if (vertex && vertex->isConstant())
     return PwrActivity(0.0, 0.0, PwrActivityOrigin::constant);
+  else if (activity_interval_ >= 0
+           && findIntervalActivity(pin, interval_activity))
+    return interval_activity;
   else if (vertex && search_->isClock(vertex)) {
     if (activity_map_.hasKey(pin)) {
       PwrActivity &activity = activity_map_[pin];
@@ -1522,6 +1659,110 @@ Power::clockMinPeriod()
 
 ////////////////////////////////////////////////////////////////
 
+PwrIntervalActivities::PwrIntervalActivities() :
+  interval_(0.0),
+  interval_count_(0),
+  end_time_(0.0)
+{
+}
+
+void
+PwrIntervalActivities::init(double interval,
+                            size_t interval_count,
+                            double end_time)
+{
+  clear();
+  interval_ = interval;
+  interval_count_ = interval_count;
+  end_time_ = end_time;
+  densities_.resize(interval_count);
+  duties_.resize(interval_count);
+}
+
+void
+PwrIntervalActivities::clear()
+{
+  interval_ = 0.0;
+  interval_count_ = 0;
+  end_time_ = 0.0;
+  pins_.clear();
+  pin_index_map_.clear();
+  densities_.clear();
+  duties_.clear();
+}
+
+size_t
+PwrIntervalActivities::addPin(const Pin *pin)
+{
+  size_t pin_index;
+  if (!findPinIndex(pin, pin_index)) {
+    pin_index = pins_.size();
+    pins_.push_back(pin);
+    pin_index_map_[pin] = pin_index;
+    for (size_t i = 0; i < interval_count_; i++) {
+      densities_[i].push_back(0.0);
+      duties_[i].push_back(0.0);
+    }
+  }
+  return pin_index;
+}
+
+bool
+PwrIntervalActivities::findPinIndex(const Pin *pin,
+                                    size_t &pin_index) const
+{
+  auto itr = pin_index_map_.find(pin);
+  if (itr != pin_index_map_.end()) {
+    pin_index = itr->second;
+    return true;
+  }
+  return false;
+}
+
+void
+PwrIntervalActivities::setActivity(size_t pin_index,
+                                   size_t interval_index,
+                                   float density,
+                                   float duty)
+{
+  densities_[interval_index][pin_index] = density;
+  duties_[interval_index][pin_index] = duty;
+}
+
+const vector<float> &
+PwrIntervalActivities::densities(size_t interval_index) const
+{
+  return densities_[interval_index];
+}
+
+const vector<float> &
+PwrIntervalActivities::duties(size_t interval_index) const
+{
+  return duties_[interval_index];
+}
+
+double
+PwrIntervalActivities::intervalEnd(size_t interval_index) const
+{
+  return min((interval_index + 1) * interval_, end_time_);
+}
+
+float
+PwrIntervalActivities::density(size_t pin_index,
+                               size_t interval_index) const
+{
+  return densities_[interval_index][pin_index];
+}
+
+float
+PwrIntervalActivities::duty(size_t pin_index,
+                            size_t interval_index) const
+{
+  return duties_[interval_index][pin_index];
+}
+
+////////////////////////////////////////////////////////////////
+
 PowerResult::PowerResult() :
   internal_(0.0),
   switching_(0.0),
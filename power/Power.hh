@@ -25,6 +25,7 @@
 #pragma once
 
 #include <utility>
+#include <vector>
 
 #include "StaConfig.hh"  // CUDD
 #include "UnorderedMap.hh"
@@ -69,6 +70,54 @@ typedef UnorderedMap<const Pin*, PwrActivity> PwrActivityMap;
 typedef UnorderedMap<SeqPin, PwrActivity,
 		     SeqPinHash, SeqPinEqual> PwrSeqActivityMap;
 
+// Activities binned by time interval (read_vcd -interval).
+// Stored column per interval so each interval is a contiguous
+// vector of pin densities.
+class PwrIntervalActivities
+{
+public:
+  PwrIntervalActivities();
+  void init(double interval,
+            size_t interval_count,
+            double end_time);
+  void clear();
+  bool empty() const { return interval_count_ == 0; }
+  // Seconds.
+  double interval() const { return interval_; }
+  size_t intervalCount() const { return interval_count_; }
+  // Seconds. The last interval ends at the VCD end time.
+  double endTime() const { return end_time_; }
+  double intervalEnd(size_t interval_index) const;
+  size_t pinCount() const { return pins_.size(); }
+  const PinSeq &pins() const { return pins_; }
+  // Return the pin index (row) of pin, adding it if necessary.
+  size_t addPin(const Pin *pin);
+  // Return false if pin has no interval activities.
+  bool findPinIndex(const Pin *pin,
+                    size_t &pin_index) const;
+  void setActivity(size_t pin_index,
+                   size_t interval_index,
+                   float density,
+                   float duty);
+  // Densities of every pin in interval_index, indexed by pin index.
+  const std::vector<float> &densities(size_t interval_index) const;
+  const std::vector<float> &duties(size_t interval_index) const;
+  float density(size_t pin_index,
+                size_t interval_index) const;
+  float duty(size_t pin_index,
+             size_t interval_index) const;
+
+private:
+  double interval_;
+  size_t interval_count_;
+  double end_time_;
+  PinSeq pins_;
+  UnorderedMap<const Pin*, size_t> pin_index_map_;
+  // [interval_index][pin_index]
+  std::vector<std::vector<float>> densities_;
+  std::vector<std::vector<float>> duties_;
+};
+
 // The Power class has access to Sta components directly for
 // convenience but also requires access to the Sta class member functions.
 class Power : public StaState
@@ -101,12 +150,27 @@ public:
 		       float activity,
 		       float duty,
 		       PwrActivityOrigin origin);
+  // Bulk setUserActivity.
+  void setUserActivities(const PwrPinActivitySeq &pin_activities);
   void unsetUserActivity(const Pin *pin);
   void reportActivityAnnotation(bool report_unannotated,
                                 bool report_annotated);
   float clockMinPeriod();
   InstanceSeq highestPowerInstances(size_t count,
                                     const Corner *corner);
+  // Activities set by setUserActivity (set_power_activity, vcd, saif).
+  const PwrActivityMap &userActivities() const { return user_activity_map_; }
+  PwrIntervalActivities &intervalActivities() { return interval_activities_; }
+  // Design power for each activity interval.
+  // Switching power is linear in the output pin density, so the per
+  // pin power/density coefficients are found once and each interval
+  // is the dot product of the coefficients with the interval densities.
+  // Internal and leakage power of instances with interval activities
+  // are found with the interval densities and duties. Instances
+  // without interval activities are found once with average activities.
+  void intervalPower(const Corner *corner,
+                     // Return value.
+                     PowerResultSeq &interval_powers);
 
 protected:
   PwrActivity &activity(const Pin *pin);
@@ -154,6 +218,16 @@ protected:
 			       const Corner *corner,
 			       // Return values.
 			       PowerResult &result);
+  bool hasIntervalActivities(const Instance *inst);
+  void findIntervalSwitchingCoefficients(const Instance *inst,
+                                         LibertyCell *cell,
+                                         const Corner *corner,
+                                         // Return values.
+                                         std::vector<float> &switching_coefs,
+                                         PowerResult &fixed);
+  bool findIntervalActivity(const Pin *pin,
+                            // Return value.
+                            PwrActivity &activity);
   void findLeakagePower(const Instance *inst,
 			LibertyCell *cell,
 			const Corner *corner,
@@ -227,6 +301,10 @@ private:
   // Propagated activities.
   PwrActivityMap activity_map_;
   PwrSeqActivityMap seq_activity_map_;
+  PwrIntervalActivities interval_activities_;
+  // Interval index findActivity uses for pins with interval
+  // activities, -1 for average activities.
+  int activity_interval_;
   bool activities_valid_;
   Bdd bdd_;
 
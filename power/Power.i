@@ -30,6 +30,7 @@
 #include "power/Power.hh"
 #include "power/VcdReader.hh"
 #include "power/SaifReader.hh"
+#include "power/ActivityDb.hh"
 
 using namespace sta;
 
@@ -157,11 +158,43 @@ highest_power_instances(size_t count,
 
 void
 read_vcd_file(const char *filename,
-              const char *scope)
+              const char *scope,
+              float interval)
 {
   Sta *sta = Sta::sta();
   sta->ensureLibLinked();
-  readVcdActivities(filename, scope, sta);
+  readVcdActivities(filename, scope, interval, sta);
+}
+
+float
+power_activity_interval()
+{
+  Power *power = Sta::sta()->power();
+  return power->intervalActivities().interval();
+}
+
+// Interval end times (seconds), clipped to the VCD end time.
+FloatSeq
+power_interval_ends()
+{
+  Power *power = Sta::sta()->power();
+  PwrIntervalActivities &interval_activities = power->intervalActivities();
+  FloatSeq ends;
+  for (size_t i = 0; i < interval_activities.intervalCount(); i++)
+    ends.push_back(interval_activities.intervalEnd(i));
+  return ends;
+}
+
+// Flattened {internal switching leakage total} per interval.
+FloatSeq
+interval_power(const Corner *corner)
+{
+  PowerResultSeq interval_powers;
+  Sta::sta()->intervalPower(corner, interval_powers);
+  FloatSeq powers;
+  for (PowerResult &power : interval_powers)
+    pushPowerResultFloats(power, powers);
+  return powers;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -175,6 +208,22 @@ read_saif_file(const char *filename,
   return readSaif(filename, scope, sta);
 }
 
+void
+write_activity_db_cmd(const char *filename)
+{
+  Sta *sta = Sta::sta();
+  sta->ensureLibLinked();
+  writeActivityDb(filename, sta);
+}
+
+void
+read_activity_db_cmd(const char *filename)
+{
+  Sta *sta = Sta::sta();
+  sta->ensureLibLinked();
+  readActivityDb(filename, sta);
+}
+
 void
 report_activity_annotation_cmd(bool report_unannotated,
                                bool report_annotated)
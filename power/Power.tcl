@@ -33,6 +33,7 @@ namespace eval sta {
 define_cmd_args "report_power" \
   { [-instances instances]\
       [-highest_power_instances count]\
+      [-interval]\
       [-corner corner]\
       [-digits digits]\
       [> filename] [>> filename] }
@@ -41,7 +42,7 @@ proc_redirect report_power {
   global sta_report_default_digits
 
   parse_key_args "report_power" args \
-    keys {-instances -highest_power_instances -corner -digits} flags {}
+    keys {-instances -highest_power_instances -corner -digits} flags {-interval}
 
   check_argc_eq0 "report_power" $args
 
@@ -64,6 +65,8 @@ proc_redirect report_power {
     check_positive_integer "-highest_power_instances" $count
     set insts [highest_power_instances $count $corner]
     report_power_insts $insts $corner $digits
+  } elseif { [info exists flags(-interval)] } {
+    report_power_intervals $corner $digits
   } else {
     report_power_design $corner $digits
   }
@@ -206,6 +209,28 @@ proc report_power_insts { insts corner digits } {
   }
 }
 
+proc report_power_intervals { corner digits } {
+  set interval [power_activity_interval]
+  if { $interval == 0.0 } {
+    sta_error 311 "report_power -interval requires read_vcd -interval."
+  }
+  set interval_powers [interval_power $corner]
+  set interval_ends [power_interval_ends]
+  set field_width [max [expr $digits + 6] 10]
+
+  report_line "[format %${field_width}s Start] [format %${field_width}s End] [format %${field_width}s Internal] [format %${field_width}s Switching] [format %${field_width}s Leakage] [format %${field_width}s Total]"
+  report_line "[format %${field_width}s ([unit_scaled_suffix time])] [format %${field_width}s {}] [format %${field_width}s Power] [format %${field_width}s Power] [format %${field_width}s Power] [format %${field_width}s Power] (Watts)"
+  report_title_dashes [expr ($field_width + 1) * 6]
+  set start 0.0
+  for {set i 0} {$i < [llength $interval_powers]} {incr i 4} {
+    set end [lindex $interval_ends [expr $i / 4]]
+    lassign [lrange $interval_powers $i [expr $i + 3]] \
+      internal switching leakage total
+    report_line "[format %${field_width}s [format_time $start $digits]] [format %${field_width}s [format_time $end $digits]][power_col $internal $field_width $digits][power_col $switching $field_width $digits][power_col $leakage $field_width $digits][power_col $total $field_width $digits]"
+    set start $end
+  }
+}
+
 proc inst_pwr_cmp { inst_pwr1 inst_pwr2 } {
   set pwr1 [lindex $inst_pwr1 1]
   set pwr2 [lindex $inst_pwr2 1]
@@ -361,16 +386,16 @@ proc read_power_activities { args } {
     set scope $keys(-scope)
   }
   sta_warn 305 "read_power_activities is deprecated. Use read_vcd."
-  read_vcd_file $filename $scope
+  read_vcd_file $filename $scope 0.0
 }
 
 ################################################################
 
-define_cmd_args "read_vcd" { [-scope scope] filename }
+define_cmd_args "read_vcd" { [-scope scope] [-interval interval] filename }
 
 proc read_vcd { args } {
   parse_key_args "read_vcd" args \
-    keys {-scope} flags {}
+    keys {-scope -interval} flags {}
 
   check_argc_eq1 "read_vcd" $args
   set filename [file nativename [lindex $args 0]]
@@ -378,7 +403,13 @@ proc read_vcd { args } {
   if { [info exists keys(-scope)] } {
     set scope $keys(-scope)
   }
-  read_vcd_file $filename $scope
+  set interval 0.0
+  if { [info exists keys(-interval)] } {
+    set interval $keys(-interval)
+    check_positive_float "-interval" $interval
+    set interval [time_ui_sta $interval]
+  }
+  read_vcd_file $filename $scope $interval
 }
 
 ################################################################
@@ -399,6 +430,26 @@ proc read_saif { args } {
 
 ################################################################
 
+define_cmd_args "write_activity_db" { filename }
+
+proc write_activity_db { args } {
+  check_argc_eq1 "write_activity_db" $args
+  set filename [file nativename [lindex $args 0]]
+  write_activity_db_cmd $filename
+}
+
+################################################################
+
+define_cmd_args "read_activity_db" { filename }
+
+proc read_activity_db { args } {
+  check_argc_eq1 "read_activity_db" $args
+  set filename [file nativename [lindex $args 0]]
+  read_activity_db_cmd $filename
+}
+
+################################################################
+
 define_cmd_args "report_activity_annotation" { [-report_unannotated] \
                                                  [-report_annotated] }
 
@@ -25,10 +25,10 @@
 #include "power/SaifReader.hh"
 
 #include <algorithm>
-#include <cinttypes>
 
 #include "Error.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Stats.hh"
 #include "Report.hh"
 #include "Network.hh"
@@ -43,6 +43,7 @@ namespace sta {
 
 using std::string;
 using std::min;
+using std::vector;
 
 bool
 readSaif(const char *filename,
@@ -65,6 +66,7 @@ SaifReader::SaifReader(const char *filename,
   timescale_(1.0E-9F),		// default units of ns
   duration_(0.0),
   in_scope_level_(0),
+  net_shards_(1),
   power_(sta->power())
 {
 }
@@ -79,6 +81,8 @@ SaifReader::read()
     SaifParse parser(&scanner, this);
     // yyparse returns 0 on success.
     bool success = (parser.parse() == 0);
+    setActivities();
+    stats.report("Read saif");
     report_->reportLine("Annotated %zu pin activities.", annotated_pins_.size());
     return success;
   }
@@ -142,7 +146,12 @@ SaifReader::instancePush(const char *instance_name)
   else {
     // Inside annotation scope.
     Instance *parent = path_.empty() ? sdc_network_->topInstance() : path_.back();
-    Instance *child = sdc_network_->findChild(parent, instance_name);
+    Instance *child = parent
+      ? sdc_network_->findChild(parent, instance_name)
+      : nullptr;
+    if (path_.empty())
+      // Top level instance block starts a new shard.
+      net_shards_.emplace_back();
     path_.push_back(child);
   }
   stringDelete(instance_name);
@@ -165,32 +174,84 @@ SaifReader::setNetDurations(const char *net_name,
 {
   if (in_scope_level_ > 0) {
     Instance *parent = path_.empty() ? sdc_network_->topInstance() : path_.back();
-    if (parent) {
-      string unescaped_name = unescaped(net_name);
-      const Pin *pin = sdc_network_->findPin(parent, unescaped_name.c_str());
-      if (pin
-          && !sdc_network_->isHierarchical(pin)
-          && !sdc_network_->direction(pin)->isInternal()) {
-        double t1 = durations[static_cast<int>(SaifState::T1)];
-        float duty = t1 / duration_;
-        double tc = durations[static_cast<int>(SaifState::TC)];
-        float density = tc / (duration_ * timescale_);
-        debugPrint(debug_, "read_saif", 2,
-                   "%s duty %.0f / %" PRIu64 " = %.2f tc %.0f density %.2f",
-                   sdc_network_->pathName(pin),
-                   t1,
-                   duration_,
-                   duty,
-                   tc,
-                   density);
-        power_->setUserActivity(pin, density, duty, PwrActivityOrigin::saif);
-        annotated_pins_.insert(pin);
-      }
-    }
+    if (parent)
+      net_shards_.back().emplace_back(parent, net_name, durations);
   }
   stringDelete(net_name);
 }
 
+// Resolve net pins for each shard in parallel and annotate them in bulk.
+void
+SaifReader::setActivities()
+{
+  size_t shard_count = net_shards_.size();
+  vector<PwrPinActivitySeq> shard_activities(shard_count);
+  if (thread_count_ > 1 && shard_count > 1) {
+    for (size_t i = 0; i < shard_count; i++) {
+      dispatch_queue_->dispatch([this, i, &shard_activities](int) {
+        findPinActivities(net_shards_[i], shard_activities[i]);
+      });
+    }
+    dispatch_queue_->finishTasks();
+  }
+  else {
+    for (size_t i = 0; i < shard_count; i++)
+      findPinActivities(net_shards_[i], shard_activities[i]);
+  }
+
+  PwrPinActivitySeq pin_activities;
+  size_t pin_count = 0;
+  for (const PwrPinActivitySeq &activities : shard_activities)
+    pin_count += activities.size();
+  pin_activities.reserve(pin_count);
+  for (PwrPinActivitySeq &activities : shard_activities) {
+    for (PwrPinActivity &pin_activity : activities) {
+      const Pin *pin = pin_activity.first;
+      const PwrActivity &activity = pin_activity.second;
+      debugPrint(debug_, "read_saif", 2, "%s duty %.2f density %.2f",
+                 sdc_network_->pathName(pin),
+                 activity.duty(),
+                 activity.density());
+      annotated_pins_.insert(pin);
+      pin_activities.push_back(pin_activity);
+    }
+  }
+  power_->setUserActivities(pin_activities);
+  net_shards_.clear();
+}
+
+void
+SaifReader::findPinActivities(const SaifNetDurationsSeq &shard,
+                              // Return value.
+                              PwrPinActivitySeq &pin_activities)
+{
+  for (const SaifNetDurations &net_durations : shard) {
+    string unescaped_name = unescaped(net_durations.netName().c_str());
+    const Pin *pin = sdc_network_->findPin(net_durations.parent(),
+                                           unescaped_name.c_str());
+    if (pin
+        && !sdc_network_->isHierarchical(pin)
+        && !sdc_network_->direction(pin)->isInternal()) {
+      const SaifStateDurations &durations = net_durations.durations();
+      double t1 = durations[static_cast<int>(SaifState::T1)];
+      float duty = t1 / duration_;
+      double tc = durations[static_cast<int>(SaifState::TC)];
+      float density = tc / (duration_ * timescale_);
+      pin_activities.emplace_back(pin, PwrActivity(density, duty,
+                                                   PwrActivityOrigin::saif));
+    }
+  }
+}
+
+SaifNetDurations::SaifNetDurations(const Instance *parent,
+                                   const char *net_name,
+                                   const SaifStateDurations &durations) :
+  parent_(parent),
+  net_name_(net_name),
+  durations_(durations)
+{
+}
+
 string
 SaifReader::unescaped(const char *token)
 {
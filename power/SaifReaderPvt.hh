@@ -33,6 +33,7 @@
 
 #include "Zlib.hh"
 #include "NetworkClass.hh"
+#include "PowerClass.hh"
 #include "StaState.hh"
 
 // Header for SaifReader.cc to communicate with SaifLex.cc, SaifParse.cc
@@ -49,6 +50,25 @@ enum class SaifState { T0, T1, TX, TZ, TB, TC, IG };
 
 typedef std::array<uint64_t, static_cast<int>(SaifState::IG)+1> SaifStateDurations;
 
+// Net durations saved during parsing to be resolved after the parse.
+class SaifNetDurations
+{
+public:
+  SaifNetDurations(const Instance *parent,
+                   const char *net_name,
+                   const SaifStateDurations &durations);
+  const Instance *parent() const { return parent_; }
+  const std::string &netName() const { return net_name_; }
+  const SaifStateDurations &durations() const { return durations_; }
+
+private:
+  const Instance *parent_;
+  std::string net_name_;
+  SaifStateDurations durations_;
+};
+
+typedef std::vector<SaifNetDurations> SaifNetDurationsSeq;
+
 class SaifReader : public StaState
 {
 public:
@@ -69,6 +89,10 @@ public:
 
 private:
   std::string unescaped(const char *token);
+  void setActivities();
+  void findPinActivities(const SaifNetDurationsSeq &shard,
+                         // Return value.
+                         PwrPinActivitySeq &pin_activities);
 
   const char *filename_;
   const char *scope_;           // Divider delimited scope to begin annotation.
@@ -80,7 +104,11 @@ private:
 
   std::vector<std::string> saif_scope_;   // Scope during parsing.
   size_t in_scope_level_;
-  std::vector<Instance*> path_;      // Path within scope.
+  // Path within scope. Instances are resolved once per INSTANCE block.
+  std::vector<Instance*> path_;
+  // Net durations sharded by top level INSTANCE block within the scope.
+  // Shard 0 is the nets of the scope instance itself.
+  std::vector<SaifNetDurationsSeq> net_shards_;
   std::set<const Pin*> annotated_pins_;
   Power *power_;
 };
@@ -48,25 +48,37 @@ using std::unordered_map;
 
 // Transition count and high time for duty cycle for a group of pins
 // for one bit of vcd ID.
+// When interval is non-zero the counts are also binned by time interval.
 class VcdCount
 {
 public:
   VcdCount();
   double transitionCount() const { return transition_count_; }
   VcdTime highTime(VcdTime time_max) const;
+  double intervalTransitionCount(size_t interval_index) const;
+  VcdTime intervalHighTime(size_t interval_index,
+                           VcdTime interval,
+                           VcdTime time_max) const;
   void incrCounts(VcdTime time,
-                  char value);
-  void incrCounts(VcdTime time,
-                  int64_t value);
+                  char value,
+                  VcdTime interval);
   void addPin(const Pin *pin);
   const PinSeq &pins() const { return pins_; }
 
 private:
+  void incrIntervalHighTime(VcdTime from,
+                            VcdTime to,
+                            VcdTime interval);
+  void ensureIntervals(size_t interval_index);
+
   PinSeq pins_;
   VcdTime prev_time_;
   char prev_value_;
   VcdTime high_time_;
   double transition_count_;
+  // Indexed by time / interval.
+  vector<float> interval_transition_counts_;
+  vector<VcdTime> interval_high_times_;
 };
 
 VcdCount::VcdCount() :
@@ -85,24 +97,60 @@ VcdCount::addPin(const Pin *pin)
 
 void
 VcdCount::incrCounts(VcdTime time,
-                     char value)
+                     char value,
+                     VcdTime interval)
 {
   // Initial value does not coontribute to transitions or high time.
   if (prev_time_ != -1) {
-    if (prev_value_ == '1')
+    if (prev_value_ == '1') {
       high_time_ += time - prev_time_;
-    if (value != prev_value_)
-      transition_count_ += (value == 'X'
+      if (interval > 0)
+        incrIntervalHighTime(prev_time_, time, interval);
+    }
+    if (value != prev_value_) {
+      double transitions = (value == 'X'
                             || value == 'Z'
                             || prev_value_ == 'X'
                             || prev_value_ == 'Z')
         ? .5
         : 1.0;
+      transition_count_ += transitions;
+      if (interval > 0) {
+        size_t interval_index = time / interval;
+        ensureIntervals(interval_index);
+        interval_transition_counts_[interval_index] += transitions;
+      }
+    }
   }
   prev_time_ = time;
   prev_value_ = value;
 }
 
+// Distribute the high time from..to across the intervals it spans.
+void
+VcdCount::incrIntervalHighTime(VcdTime from,
+                               VcdTime to,
+                               VcdTime interval)
+{
+  while (from < to) {
+    size_t interval_index = from / interval;
+    VcdTime interval_end = (interval_index + 1) * interval;
+    VcdTime high_end = min(to, interval_end);
+    ensureIntervals(interval_index);
+    interval_high_times_[interval_index] += high_end - from;
+    from = high_end;
+  }
+}
+
+void
+VcdCount::ensureIntervals(size_t interval_index)
+{
+  if (interval_index >= interval_transition_counts_.size()) {
+    interval_transition_counts_.resize(interval_index + 1, 0.0);
+    interval_high_times_.resize(interval_index + 1, 0);
+  }
+}
+
 VcdTime
 VcdCount::highTime(VcdTime time_max) const
 {
@@ -112,6 +160,34 @@ VcdCount::highTime(VcdTime time_max) const
     return high_time_;
 }
 
+double
+VcdCount::intervalTransitionCount(size_t interval_index) const
+{
+  if (interval_index < interval_transition_counts_.size())
+    return interval_transition_counts_[interval_index];
+  else
+    return 0.0;
+}
+
+VcdTime
+VcdCount::intervalHighTime(size_t interval_index,
+                           VcdTime interval,
+                           VcdTime time_max) const
+{
+  VcdTime high_time = (interval_index < interval_high_times_.size())
+    ? interval_high_times_[interval_index]
+    : 0;
+  // Value after the last change holds until time_max.
+  if (prev_value_ == '1') {
+    VcdTime interval_start = interval_index * interval;
+    VcdTime interval_end = min(interval_start + interval, time_max);
+    VcdTime high_start = std::max(prev_time_, interval_start);
+    if (interval_end > high_start)
+      high_time += interval_end - high_start;
+  }
+  return high_time;
+}
+
 ////////////////////////////////////////////////////////////////
 
 // VcdCount[bit]
@@ -123,12 +199,15 @@ class VcdCountReader : public VcdReader
 {
 public:
   VcdCountReader(const char *scope,
+                 double interval,
                  Network *sdc_network,
                  Report *report,
                  Debug *debug);
   VcdTime timeMax() const { return time_max_; }
   const VcdIdCountsMap &countMap() const { return vcd_count_map_; }
   double timeScale() const { return time_scale_; }
+  // Activity interval in vcd time units (zero for no intervals).
+  VcdTime interval() const { return interval_; }
 
   // VcdParse callbacks.
   void setDate(const string &) override {}
@@ -159,24 +238,30 @@ private:
                  size_t bit_idx);
 
   const char *scope_;
+  // Seconds.
+  double interval_sec_;
   Network *sdc_network_;
   Report *report_;
   Debug *debug_;
 
   double time_scale_;
+  VcdTime interval_;
   VcdTime time_max_;
   VcdIdCountsMap vcd_count_map_;
 };
 
 VcdCountReader::VcdCountReader(const char *scope,
+                               double interval,
                                Network *sdc_network,
                                Report *report,
                                Debug *debug) :
   scope_(scope),
+  interval_sec_(interval),
   sdc_network_(sdc_network),
   report_(report),
   debug_(debug),
   time_scale_(1.0),
+  interval_(0),
   time_max_(0.0)
 {
 }
@@ -187,6 +272,9 @@ VcdCountReader::setTimeUnit(const string &,
                             double time_scale)
 {
   time_scale_ = time_scale * time_unit_scale;
+  if (interval_sec_ > 0.0)
+    interval_ = std::max(static_cast<VcdTime>(interval_sec_ / time_scale_ + .5),
+                         static_cast<VcdTime>(1));
 }
 
 void
@@ -307,7 +395,7 @@ VcdCountReader::varAppendValue(const string &id,
     }
     for (size_t bit_idx = 0; bit_idx < vcd_counts.size(); bit_idx++) {
       VcdCount &vcd_count = vcd_counts[bit_idx];
-      vcd_count.incrCounts(time, value);
+      vcd_count.incrCounts(time, value, interval_);
     }
   }
 }
@@ -331,7 +419,7 @@ VcdCountReader::varAppendBusValue(const string &id,
                      bit_value);
         }
       }
-      vcd_count.incrCounts(time, bit_value);
+      vcd_count.incrCounts(time, bit_value, interval_);
     }
   }
 }
@@ -343,11 +431,13 @@ class ReadVcdActivities : public StaState
 public:
   ReadVcdActivities(const char *filename,
                     const char *scope,
+                    double interval,
                     Sta *sta);
   void readActivities();
 
 private:
   void setActivities();
+  void setIntervalActivities();
   void checkClkPeriod(const Pin *pin,
                       double transition_count);
 
@@ -364,18 +454,20 @@ private:
 void
 readVcdActivities(const char *filename,
                   const char *scope,
+                  double interval,
                   Sta *sta)
 {
-  ReadVcdActivities reader(filename, scope, sta);
+  ReadVcdActivities reader(filename, scope, interval, sta);
   reader.readActivities();
 }
 
 ReadVcdActivities::ReadVcdActivities(const char *filename,
                                      const char *scope,
+                                     double interval,
                                      Sta *sta) :
   StaState(sta),
   filename_(filename),
-  vcd_reader_(scope, sdc_network_, report_, debug_),
+  vcd_reader_(scope, interval, sdc_network_, report_, debug_),
   vcd_parse_(report_, debug_),
   power_(sta->power())
 {
@@ -390,8 +482,10 @@ ReadVcdActivities::readActivities()
 
   vcd_parse_.read(filename_, &vcd_reader_);
 
-  if (vcd_reader_.timeMax() > 0)
+  if (vcd_reader_.timeMax() > 0) {
     setActivities();
+    setIntervalActivities();
+  }
   else
     report_->warn(1450, "VCD max time is zero.");
   report_->reportLine("Annotated %zu pin activities.", annotated_pins_.size());
@@ -428,6 +522,43 @@ ReadVcdActivities::setActivities()
   }
 }
 
+void
+ReadVcdActivities::setIntervalActivities()
+{
+  PwrIntervalActivities &interval_activities = power_->intervalActivities();
+  interval_activities.clear();
+  VcdTime interval = vcd_reader_.interval();
+  if (interval > 0) {
+    VcdTime time_max = vcd_reader_.timeMax();
+    double time_scale = vcd_reader_.timeScale();
+    size_t interval_count = (time_max + interval - 1) / interval;
+    interval_activities.init(interval * time_scale, interval_count,
+                             time_max * time_scale);
+    for (auto& [id, vcd_counts] : vcd_reader_.countMap()) {
+      for (const VcdCount &vcd_count : vcd_counts) {
+        for (const Pin *pin : vcd_count.pins()) {
+          size_t pin_index = interval_activities.addPin(pin);
+          for (size_t i = 0; i < interval_count; i++) {
+            VcdTime start = i * interval;
+            VcdTime length = min(interval, time_max - start);
+            double transition_count = vcd_count.intervalTransitionCount(i);
+            // Transitions at time_max land one past the last interval.
+            if (i == interval_count - 1)
+              transition_count += vcd_count.intervalTransitionCount(interval_count);
+            VcdTime high_time = vcd_count.intervalHighTime(i, interval, time_max);
+            float duty = static_cast<double>(high_time) / length;
+            float density = transition_count / (length * time_scale);
+            interval_activities.setActivity(pin_index, i, density, duty);
+          }
+        }
+      }
+    }
+    debugPrint(debug_, "read_vcd_activities", 1, "%zu intervals %zu pins",
+               interval_count,
+               interval_activities.pinCount());
+  }
+}
+
 void
 ReadVcdActivities::checkClkPeriod(const Pin *pin,
                                   double transition_count)
@@ -28,9 +28,12 @@ namespace sta {
 
 class Sta;
 
+// interval is the activity bin width in seconds for per-interval
+// power (zero to only annotate the average activity).
 void
 readVcdActivities(const char *filename,
                   const char *scope,
+                  double interval,
                   Sta *sta);
 
 } // namespace
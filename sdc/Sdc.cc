@@ -122,6 +122,7 @@ Sdc::Sdc(StaState *sta) :
   exception_id_(0),
   have_thru_hpin_exceptions_(false),
   first_thru_edge_exceptions_(0, PinPairHash(network_), PinPairEqual()),
+  exception_thru_index_valid_(false),
   path_delay_internal_from_(network_),
   path_delay_internal_from_break_(network_),
   path_delay_internal_to_(network_),
@@ -4602,6 +4603,7 @@ Sdc::recordException(ExceptionPath *exception)
   recordMergeHashes(exception);
   recordExceptionFirstPts(exception);
   checkForThruHpins(exception);
+  exception_thru_index_valid_ = false;
 }
 
 void
@@ -4881,6 +4883,7 @@ Sdc::deleteExceptions()
   deleteExceptionPtHashMapSets(exception_merge_hash_);
   exception_merge_hash_.clear();
   have_thru_hpin_exceptions_ = false;
+  exception_thru_index_valid_ = false;
 }
 
 void
@@ -4946,6 +4949,8 @@ Sdc::unrecordException(ExceptionPath *exception)
   unrecordMergeHashes(exception);
   unrecordExceptionFirstPts(exception);
   exceptions_.erase(exception);
+  // Exception point merging follows unrecording.
+  exception_thru_index_valid_ = false;
 }
 
 void
@@ -5341,6 +5346,58 @@ Sdc::exceptionThruStates(const Pin *from_pin,
   }
 }
 
+bool
+Sdc::isExceptionThruPin(const Pin *pin)
+{
+  ensureExceptionThruIndex();
+  return exception_thru_pins_.hasKey(pin)
+    || (!exception_thru_nets_.empty()
+        && exception_thru_nets_.hasKey(network_->net(pin)))
+    || (!exception_thru_insts_.empty()
+        && exception_thru_insts_.hasKey(network_->instance(pin)));
+}
+
+// Mirrors ExceptionThru::matches so the index is a superset of the
+// pins any -thru can match.
+void
+Sdc::ensureExceptionThruIndex()
+{
+  if (!exception_thru_index_valid_) {
+    LockGuard lock(exception_thru_index_lock_);
+    if (!exception_thru_index_valid_) {
+      exception_thru_pins_.clear();
+      exception_thru_nets_.clear();
+      exception_thru_insts_.clear();
+      for (ExceptionPath *exception : exceptions_) {
+        ExceptionThruSeq *thrus = exception->thrus();
+        if (thrus) {
+          for (ExceptionThru *thru : *thrus) {
+            if (thru->pins())
+              exception_thru_pins_.insert(thru->pins()->begin(),
+                                          thru->pins()->end());
+            if (thru->edges()) {
+              for (const EdgePins &edge_pins : *thru->edges())
+                exception_thru_pins_.insert(edge_pins.second);
+            }
+            if (thru->nets())
+              exception_thru_nets_.insert(thru->nets()->begin(),
+                                          thru->nets()->end());
+            if (thru->instances())
+              exception_thru_insts_.insert(thru->instances()->begin(),
+                                           thru->instances()->end());
+          }
+        }
+      }
+      debugPrint(debug_, "exception_thru", 1,
+                 "exception thru index %zu pins %zu nets %zu instances",
+                 exception_thru_pins_.size(),
+                 exception_thru_nets_.size(),
+                 exception_thru_insts_.size());
+      exception_thru_index_valid_ = true;
+    }
+  }
+}
+
 void
 Sdc::exceptionThruStates(const ExceptionPathSet *exceptions,
 			 const RiseFall *to_rf,
@@ -5555,6 +5612,7 @@ Sdc::connectPinAfter(const Pin *pin)
         }
       }
     }
+    exception_thru_index_valid_ = false;
   }
 }
 
@@ -40,7 +40,8 @@ Variables::Variables() :
   dynamic_loop_breaking_(false),
   propagate_all_clks_(false),
   use_default_arrival_clock_(false),
-  pocv_enabled_(false)
+  pocv_enabled_(false),
+  tag_compression_(false)
 {
 }
 
@@ -127,5 +128,11 @@ Variables::setPocvEnabled(bool enabled)
 {
   pocv_enabled_ = enabled;
 }
+
+void
+Variables::setTagCompression(bool enable)
+{
+  tag_compression_ = enable;
+}
   
 } // namespace
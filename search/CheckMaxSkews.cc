@@ -33,6 +33,7 @@
 #include "Path.hh"
 #include "PathAnalysisPt.hh"
 #include "Search.hh"
+#include "ParallelVisit.hh"
 
 namespace sta {
 
@@ -42,8 +43,11 @@ class MaxSkewCheckVisitor
 public:
   MaxSkewCheckVisitor() {}
   virtual ~MaxSkewCheckVisitor() {}
+  virtual MaxSkewCheckVisitor *copy() const = 0;
   virtual void visit(MaxSkewCheck &check,
 		     const StaState *sta) = 0;
+  // Merge the results of a copy used to visit a subset of the vertices.
+  virtual void merge(MaxSkewCheckVisitor *visitor) = 0;
 };
 
 CheckMaxSkews::CheckMaxSkews(StaState *sta) :
@@ -62,46 +66,35 @@ CheckMaxSkews::clear()
   checks_.deleteContentsClear();
 }
 
-class MaxSkewChecksVisitor : public MaxSkewCheckVisitor
+class MaxSkewViolatorsVisititor : public MaxSkewCheckVisitor
 {
 public:
-  explicit MaxSkewChecksVisitor(MaxSkewCheckSeq &checks);
+  MaxSkewViolatorsVisititor();
+  virtual ~MaxSkewViolatorsVisititor();
+  virtual MaxSkewCheckVisitor *copy() const;
   virtual void visit(MaxSkewCheck &check,
 		     const StaState *sta);
+  virtual void merge(MaxSkewCheckVisitor *visitor);
+  MaxSkewCheckSeq &checks() { return checks_; }
 
 private:
-  MaxSkewCheckSeq &checks_;
+  MaxSkewCheckSeq checks_;
 };
 
-MaxSkewChecksVisitor::MaxSkewChecksVisitor(MaxSkewCheckSeq &checks) :
-  MaxSkewCheckVisitor(),
-  checks_(checks)
+MaxSkewViolatorsVisititor::MaxSkewViolatorsVisititor() :
+  MaxSkewCheckVisitor()
 {
 }
 
-void
-MaxSkewChecksVisitor::visit(MaxSkewCheck &check,
-			    const StaState *)
+MaxSkewViolatorsVisititor::~MaxSkewViolatorsVisititor()
 {
-  checks_.push_back(new MaxSkewCheck(check));
+  checks_.deleteContents();
 }
 
-class MaxSkewViolatorsVisititor : public MaxSkewCheckVisitor
-{
-public:
-  explicit MaxSkewViolatorsVisititor(MaxSkewCheckSeq &checks);
-  virtual void visit(MaxSkewCheck &check,
-		     const StaState *sta);
-
-private:
-  MaxSkewCheckSeq &checks_;
-};
-
-MaxSkewViolatorsVisititor::
-MaxSkewViolatorsVisititor(MaxSkewCheckSeq &checks) :
-  MaxSkewCheckVisitor(),
-  checks_(checks)
+MaxSkewCheckVisitor *
+MaxSkewViolatorsVisititor::copy() const
 {
+  return new MaxSkewViolatorsVisititor;
 }
 
 void
@@ -112,12 +105,23 @@ MaxSkewViolatorsVisititor::visit(MaxSkewCheck &check,
     checks_.push_back(new MaxSkewCheck(check));
 }
 
+void
+MaxSkewViolatorsVisititor::merge(MaxSkewCheckVisitor *visitor)
+{
+  MaxSkewViolatorsVisititor *visitor1 =
+    dynamic_cast<MaxSkewViolatorsVisititor*>(visitor);
+  checks_.insert(checks_.end(), visitor1->checks_.begin(),
+                 visitor1->checks_.end());
+  visitor1->checks_.clear();
+}
+
 MaxSkewCheckSeq &
 CheckMaxSkews::violations()
 {
   clear();
-  MaxSkewViolatorsVisititor visitor(checks_);
+  MaxSkewViolatorsVisititor visitor;
   visitMaxSkewChecks(&visitor);
+  checks_.swap(visitor.checks());
   sort(checks_, MaxSkewSlackLess(sta_));
   return checks_;
 }
@@ -125,44 +129,74 @@ CheckMaxSkews::violations()
 class MaxSkewSlackVisitor : public MaxSkewCheckVisitor
 {
 public:
-  MaxSkewSlackVisitor();
+  explicit MaxSkewSlackVisitor(const StaState *sta);
+  virtual ~MaxSkewSlackVisitor();
+  virtual MaxSkewCheckVisitor *copy() const;
   virtual void visit(MaxSkewCheck &check,
 		     const StaState *sta);
+  virtual void merge(MaxSkewCheckVisitor *visitor);
+  // Caller owns the check.
   MaxSkewCheck *minSlackCheck();
 
 private:
   MaxSkewCheck *min_slack_check_;
+  MaxSkewSlackLess slack_less_;
+  const StaState *sta_;
 };
 
-MaxSkewSlackVisitor::MaxSkewSlackVisitor() :
+MaxSkewSlackVisitor::MaxSkewSlackVisitor(const StaState *sta) :
   MaxSkewCheckVisitor(),
-  min_slack_check_(nullptr)
+  min_slack_check_(nullptr),
+  slack_less_(sta),
+  sta_(sta)
 {
 }
 
+MaxSkewSlackVisitor::~MaxSkewSlackVisitor()
+{
+  delete min_slack_check_;
+}
+
+MaxSkewCheckVisitor *
+MaxSkewSlackVisitor::copy() const
+{
+  return new MaxSkewSlackVisitor(sta_);
+}
+
 void
 MaxSkewSlackVisitor::visit(MaxSkewCheck &check,
-			   const StaState *sta)
+			   const StaState *)
 {
-  MaxSkewSlackLess slack_less(sta);
   if (min_slack_check_ == nullptr
-      || slack_less(&check, min_slack_check_)) {
+      || slack_less_(&check, min_slack_check_)) {
     delete min_slack_check_;
     min_slack_check_ = new MaxSkewCheck(check);
   }
 }
 
+void
+MaxSkewSlackVisitor::merge(MaxSkewCheckVisitor *visitor)
+{
+  MaxSkewSlackVisitor *visitor1 = dynamic_cast<MaxSkewSlackVisitor*>(visitor);
+  MaxSkewCheck *check = visitor1->minSlackCheck();
+  if (check)
+    visit(*check, nullptr);
+  delete check;
+}
+
 MaxSkewCheck *
 MaxSkewSlackVisitor::minSlackCheck()
 {
-  return min_slack_check_;
+  MaxSkewCheck *check = min_slack_check_;
+  min_slack_check_ = nullptr;
+  return check;
 }
 
 MaxSkewCheck *
 CheckMaxSkews::minSlackCheck()
 {
   clear();
-  MaxSkewSlackVisitor visitor;
+  MaxSkewSlackVisitor visitor(sta_);
   visitMaxSkewChecks(&visitor);
   MaxSkewCheck *check = visitor.minSlackCheck();
   // Save check for cleanup.
@@ -174,11 +208,18 @@ void
 CheckMaxSkews::visitMaxSkewChecks(MaxSkewCheckVisitor *visitor)
 {
   Graph *graph = sta_->graph();
+  VertexSeq vertices;
   VertexIterator vertex_iter(graph);
   while (vertex_iter.hasNext()) {
     Vertex *vertex = vertex_iter.next();
-    visitMaxSkewChecks(vertex, visitor);
+    if (vertex->hasChecks())
+      vertices.push_back(vertex);
   }
+  visitParallel<MaxSkewCheckVisitor>(vertices.size(), visitor, sta_,
+                                     [&] (size_t index,
+                                          MaxSkewCheckVisitor *visitor1) {
+    visitMaxSkewChecks(vertices[index], visitor1);
+  });
 }
 
 void
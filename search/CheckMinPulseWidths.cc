@@ -42,6 +42,7 @@
 #include "PathEnd.hh"
 #include "Search.hh"
 #include "search/Crpr.hh"
+#include "ParallelVisit.hh"
 
 namespace sta {
 
@@ -58,8 +59,11 @@ class MinPulseWidthCheckVisitor
 public:
   MinPulseWidthCheckVisitor() {}
   virtual ~MinPulseWidthCheckVisitor() {}
+  virtual MinPulseWidthCheckVisitor *copy() const = 0;
   virtual void visit(MinPulseWidthCheck &check,
 		     const StaState *sta) = 0;
+  // Merge the results of a copy used to visit a subset of the vertices.
+  virtual void merge(MinPulseWidthCheckVisitor *visitor) = 0;
 };
 
 CheckMinPulseWidths::CheckMinPulseWidths(StaState *sta) :
@@ -83,22 +87,34 @@ CheckMinPulseWidths::clear()
 class MinPulseWidthChecksVisitor : public MinPulseWidthCheckVisitor
 {
 public:
-  explicit MinPulseWidthChecksVisitor(const Corner *corner,
-				      MinPulseWidthCheckSeq &checks);
+  explicit MinPulseWidthChecksVisitor(const Corner *corner);
+  virtual ~MinPulseWidthChecksVisitor();
+  virtual MinPulseWidthCheckVisitor *copy() const;
   virtual void visit(MinPulseWidthCheck &check,
 		     const StaState *sta);
+  virtual void merge(MinPulseWidthCheckVisitor *visitor);
+  MinPulseWidthCheckSeq &checks() { return checks_; }
 
-private:
+protected:
   const Corner *corner_;
-  MinPulseWidthCheckSeq &checks_;
+  MinPulseWidthCheckSeq checks_;
 };
 
 MinPulseWidthChecksVisitor::
-MinPulseWidthChecksVisitor(const Corner *corner,
-			   MinPulseWidthCheckSeq &checks) :
-  corner_(corner),
-  checks_(checks)
+MinPulseWidthChecksVisitor(const Corner *corner) :
+  corner_(corner)
+{
+}
+
+MinPulseWidthChecksVisitor::~MinPulseWidthChecksVisitor()
+{
+  checks_.deleteContents();
+}
+
+MinPulseWidthCheckVisitor *
+MinPulseWidthChecksVisitor::copy() const
 {
+  return new MinPulseWidthChecksVisitor(corner_);
 }
 
 void
@@ -112,12 +128,23 @@ MinPulseWidthChecksVisitor::visit(MinPulseWidthCheck &check,
   }
 }
 
+void
+MinPulseWidthChecksVisitor::merge(MinPulseWidthCheckVisitor *visitor)
+{
+  MinPulseWidthChecksVisitor *visitor1 =
+    dynamic_cast<MinPulseWidthChecksVisitor*>(visitor);
+  checks_.insert(checks_.end(), visitor1->checks_.begin(),
+                 visitor1->checks_.end());
+  visitor1->checks_.clear();
+}
+
 MinPulseWidthCheckSeq &
 CheckMinPulseWidths::check(const Corner *corner)
 {
   clear();
-  MinPulseWidthChecksVisitor visitor(corner, checks_);
+  MinPulseWidthChecksVisitor visitor(corner);
   visitMinPulseWidthChecks(&visitor);
+  checks_.swap(visitor.checks());
   sort(checks_, MinPulseWidthSlackLess(sta_));
   return checks_;
 }
@@ -128,38 +155,39 @@ CheckMinPulseWidths::check(PinSeq *pins,
 {
   clear();
   Graph *graph = sta_->graph();
-  MinPulseWidthChecksVisitor visitor(corner, checks_);
+  MinPulseWidthChecksVisitor visitor(corner);
   PinSeq::Iterator pin_iter(pins);
   while (pin_iter.hasNext()) {
     const Pin *pin = pin_iter.next();
     Vertex *vertex = graph->pinLoadVertex(pin);
     visitMinPulseWidthChecks(vertex, &visitor);
   }
+  checks_.swap(visitor.checks());
   sort(checks_, MinPulseWidthSlackLess(sta_));
   return checks_;
 }
 
 ////////////////////////////////////////////////////////////////
 
-class MinPulseWidthViolatorsVisitor : public MinPulseWidthCheckVisitor
+class MinPulseWidthViolatorsVisitor : public MinPulseWidthChecksVisitor
 {
 public:
-  explicit MinPulseWidthViolatorsVisitor(const Corner *corner,
-					 MinPulseWidthCheckSeq &checks);
+  explicit MinPulseWidthViolatorsVisitor(const Corner *corner);
+  virtual MinPulseWidthCheckVisitor *copy() const;
   virtual void visit(MinPulseWidthCheck &check,
 		     const StaState *sta);
-
-private:
-  const Corner *corner_;
-  MinPulseWidthCheckSeq &checks_;
 };
 
 MinPulseWidthViolatorsVisitor::
-MinPulseWidthViolatorsVisitor(const Corner *corner,
-			      MinPulseWidthCheckSeq &checks) :
-  corner_(corner),
-  checks_(checks)
+MinPulseWidthViolatorsVisitor(const Corner *corner) :
+  MinPulseWidthChecksVisitor(corner)
+{
+}
+
+MinPulseWidthCheckVisitor *
+MinPulseWidthViolatorsVisitor::copy() const
 {
+  return new MinPulseWidthViolatorsVisitor(corner_);
 }
 
 void
@@ -178,8 +206,9 @@ MinPulseWidthCheckSeq &
 CheckMinPulseWidths::violations(const Corner *corner)
 {
   clear();
-  MinPulseWidthViolatorsVisitor visitor(corner, checks_);
+  MinPulseWidthViolatorsVisitor visitor(corner);
   visitMinPulseWidthChecks(&visitor);
+  checks_.swap(visitor.checks());
   sort(checks_, MinPulseWidthSlackLess(sta_));
   return checks_;
 }
@@ -189,20 +218,39 @@ CheckMinPulseWidths::violations(const Corner *corner)
 class MinPulseWidthSlackVisitor : public MinPulseWidthCheckVisitor
 {
 public:
-  MinPulseWidthSlackVisitor(const Corner *corner);
+  MinPulseWidthSlackVisitor(const Corner *corner,
+                            const StaState *sta);
+  virtual ~MinPulseWidthSlackVisitor();
+  virtual MinPulseWidthCheckVisitor *copy() const;
   virtual void visit(MinPulseWidthCheck &check,
 		     const StaState *sta);
+  virtual void merge(MinPulseWidthCheckVisitor *visitor);
+  // Caller owns the check.
   MinPulseWidthCheck *minSlackCheck();
 
 private:
   const Corner *corner_;
   MinPulseWidthCheck *min_slack_check_;
+  const StaState *sta_;
 };
 
-MinPulseWidthSlackVisitor::MinPulseWidthSlackVisitor(const Corner *corner) :
+MinPulseWidthSlackVisitor::MinPulseWidthSlackVisitor(const Corner *corner,
+                                                     const StaState *sta) :
   corner_(corner),
-  min_slack_check_(nullptr)
+  min_slack_check_(nullptr),
+  sta_(sta)
+{
+}
+
+MinPulseWidthSlackVisitor::~MinPulseWidthSlackVisitor()
 {
+  delete min_slack_check_;
+}
+
+MinPulseWidthCheckVisitor *
+MinPulseWidthSlackVisitor::copy() const
+{
+  return new MinPulseWidthSlackVisitor(corner_, sta_);
 }
 
 void
@@ -221,17 +269,30 @@ MinPulseWidthSlackVisitor::visit(MinPulseWidthCheck &check,
   }
 }
 
+void
+MinPulseWidthSlackVisitor::merge(MinPulseWidthCheckVisitor *visitor)
+{
+  MinPulseWidthSlackVisitor *visitor1 =
+    dynamic_cast<MinPulseWidthSlackVisitor*>(visitor);
+  MinPulseWidthCheck *check = visitor1->minSlackCheck();
+  if (check)
+    visit(*check, sta_);
+  delete check;
+}
+
 MinPulseWidthCheck *
 MinPulseWidthSlackVisitor::minSlackCheck()
 {
-  return min_slack_check_;
+  MinPulseWidthCheck *check = min_slack_check_;
+  min_slack_check_ = nullptr;
+  return check;
 }
 
 MinPulseWidthCheck *
 CheckMinPulseWidths::minSlackCheck(const Corner *corner)
 {
   clear();
-  MinPulseWidthSlackVisitor visitor(corner);
+  MinPulseWidthSlackVisitor visitor(corner, sta_);
   visitMinPulseWidthChecks(&visitor);
   MinPulseWidthCheck *check = visitor.minSlackCheck();
   // Save check for cleanup.
@@ -245,15 +306,21 @@ visitMinPulseWidthChecks(MinPulseWidthCheckVisitor *visitor)
 {
   Graph *graph = sta_->graph();
   Debug *debug = sta_->debug();
+  VertexSeq vertices;
   VertexIterator vertex_iter(graph);
   while (vertex_iter.hasNext()) {
     Vertex *vertex = vertex_iter.next();
     if (isClkEnd(vertex, graph)) {
       debugPrint(debug, "mpw", 1, "check mpw %s",
                  vertex->to_string(sta_).c_str());
-      visitMinPulseWidthChecks(vertex, visitor);
+      vertices.push_back(vertex);
     }
   }
+  visitParallel<MinPulseWidthCheckVisitor>(vertices.size(), visitor, sta_,
+                                           [&] (size_t index,
+                                                MinPulseWidthCheckVisitor *visitor1) {
+    visitMinPulseWidthChecks(vertices[index], visitor1);
+  });
 }
 
 void
@@ -59,6 +59,9 @@ public:
                   Path *path,
                   bool include_internal_latency,
                   StaState *sta);
+  // Keep the worst latencies of this and delays.
+  void mergeWith(const ClkDelays &delays,
+                 const StaState *sta);
 
 private:
   static float insertionDelay(Path *clk_path,
@@ -38,6 +38,7 @@
 #include "Search.hh"
 #include "PathAnalysisPt.hh"
 #include "ClkInfo.hh"
+#include "ParallelVisit.hh"
 
 namespace sta {
 
@@ -141,43 +142,94 @@ ClkLatency::reportClkLatency(const Clock *clk,
   }
 }
 
+// Clock delays found from a chunk of register clock pins.
+class ClkDelaysVisitor
+{
+public:
+  ClkDelaysVisitor(ConstClockSeq &clks,
+                   const StaState *sta);
+  ClkDelaysVisitor *copy() const;
+  void merge(ClkDelaysVisitor *visitor);
+  ClkDelayMap &clkDelays() { return clk_delay_map_; }
+
+private:
+  ConstClockSeq &clks_;
+  ClkDelayMap clk_delay_map_;
+  const StaState *sta_;
+};
+
+ClkDelaysVisitor::ClkDelaysVisitor(ConstClockSeq &clks,
+                                   const StaState *sta) :
+  clks_(clks),
+  sta_(sta)
+{
+  // Make entries for the relevant clocks to filter path clocks.
+  for (const Clock *clk : clks)
+    clk_delay_map_[clk];
+}
+
+ClkDelaysVisitor *
+ClkDelaysVisitor::copy() const
+{
+  return new ClkDelaysVisitor(clks_, sta_);
+}
+
+void
+ClkDelaysVisitor::merge(ClkDelaysVisitor *visitor)
+{
+  for (auto& [clk, clk_delays] : visitor->clk_delay_map_)
+    clk_delay_map_[clk].mergeWith(clk_delays, sta_);
+}
+
 ClkDelayMap
 ClkLatency::findClkDelays(ConstClockSeq &clks,
                           const Corner *corner,
                           bool include_internal_latency)
 {
-  ClkDelayMap clk_delay_map;
-  // Make entries for the relevant clocks to filter path clocks.
-  for (const Clock *clk : clks)
-    clk_delay_map[clk];
-  for (Vertex *clk_vertex : *graph_->regClkVertices()) {
-    VertexPathIterator path_iter(clk_vertex, this);
-    while (path_iter.hasNext()) {
-      Path *path = path_iter.next();
-      const ClockEdge *path_clk_edge = path->clkEdge(this);
-      const PathAnalysisPt *path_ap = path->pathAnalysisPt(this);
-      if (path_clk_edge
-          && (corner == nullptr
-              || path_ap->corner() == corner)) {
-        const Clock *path_clk = path_clk_edge->clock();
-        auto delays_itr = clk_delay_map.find(path_clk);
-        if (delays_itr != clk_delay_map.end()) {
-          ClkDelays &clk_delays = delays_itr->second;
-          const RiseFall *clk_rf = path_clk_edge->transition();
-          const MinMax *min_max = path->minMax(this);
-          const RiseFall *end_rf = path->transition(this);
-          Delay latency = ClkDelays::latency(path, this);
-          Delay clk_latency;
-          bool exists;
-          clk_delays.latency(clk_rf, end_rf, min_max, clk_latency, exists);
-          if (!exists || delayGreater(latency, clk_latency, min_max, this))
-            clk_delays.setLatency(clk_rf, end_rf, min_max, path,
-                                  include_internal_latency, this);
-        }
+  VertexSeq clk_vertices;
+  for (Vertex *clk_vertex : *graph_->regClkVertices())
+    clk_vertices.push_back(clk_vertex);
+  ClkDelaysVisitor visitor(clks, this);
+  visitParallel<ClkDelaysVisitor>(clk_vertices.size(), &visitor, this,
+                                  [&] (size_t index,
+                                       ClkDelaysVisitor *visitor1) {
+    findClkDelays(clk_vertices[index], corner, include_internal_latency,
+                  visitor1->clkDelays());
+  });
+  return visitor.clkDelays();
+}
+
+void
+ClkLatency::findClkDelays(Vertex *clk_vertex,
+                          const Corner *corner,
+                          bool include_internal_latency,
+                          ClkDelayMap &clk_delay_map)
+{
+  VertexPathIterator path_iter(clk_vertex, this);
+  while (path_iter.hasNext()) {
+    Path *path = path_iter.next();
+    const ClockEdge *path_clk_edge = path->clkEdge(this);
+    const PathAnalysisPt *path_ap = path->pathAnalysisPt(this);
+    if (path_clk_edge
+        && (corner == nullptr
+            || path_ap->corner() == corner)) {
+      const Clock *path_clk = path_clk_edge->clock();
+      auto delays_itr = clk_delay_map.find(path_clk);
+      if (delays_itr != clk_delay_map.end()) {
+        ClkDelays &clk_delays = delays_itr->second;
+        const RiseFall *clk_rf = path_clk_edge->transition();
+        const MinMax *min_max = path->minMax(this);
+        const RiseFall *end_rf = path->transition(this);
+        Delay latency = ClkDelays::latency(path, this);
+        Delay clk_latency;
+        bool exists;
+        clk_delays.latency(clk_rf, end_rf, min_max, clk_latency, exists);
+        if (!exists || delayGreater(latency, clk_latency, min_max, this))
+          clk_delays.setLatency(clk_rf, end_rf, min_max, path,
+                                include_internal_latency, this);
       }
     }
   }
-  return clk_delay_map;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -266,6 +318,36 @@ ClkDelays::setLatency(const RiseFall *src_rf,
   exists_[src_rf_index][end_rf_index][mm_index] = true;
 }
 
+void
+ClkDelays::mergeWith(const ClkDelays &delays,
+                     const StaState *sta)
+{
+  for (auto src_rf_index : RiseFall::rangeIndex()) {
+    for (auto end_rf_index : RiseFall::rangeIndex()) {
+      for (const MinMax *min_max : MinMax::range()) {
+        int mm_index = min_max->index();
+        if (delays.exists_[src_rf_index][end_rf_index][mm_index]
+            && (!exists_[src_rf_index][end_rf_index][mm_index]
+                || delayGreater(delays.latency_[src_rf_index][end_rf_index][mm_index],
+                                latency_[src_rf_index][end_rf_index][mm_index],
+                                min_max, sta))) {
+          insertion_[src_rf_index][end_rf_index][mm_index] =
+            delays.insertion_[src_rf_index][end_rf_index][mm_index];
+          delay_[src_rf_index][end_rf_index][mm_index] =
+            delays.delay_[src_rf_index][end_rf_index][mm_index];
+          internal_latency_[src_rf_index][end_rf_index][mm_index] =
+            delays.internal_latency_[src_rf_index][end_rf_index][mm_index];
+          latency_[src_rf_index][end_rf_index][mm_index] =
+            delays.latency_[src_rf_index][end_rf_index][mm_index];
+          path_[src_rf_index][end_rf_index][mm_index] =
+            delays.path_[src_rf_index][end_rf_index][mm_index];
+          exists_[src_rf_index][end_rf_index][mm_index] = true;
+        }
+      }
+    }
+  }
+}
+
 Delay
 ClkDelays::latency(Path *clk_path,
                    StaState *sta)
@@ -27,10 +27,8 @@
 #include <cmath> // abs
 #include <algorithm>
 
-#include "Fuzzy.hh"
 #include "Report.hh"
 #include "Debug.hh"
-#include "DispatchQueue.hh"
 #include "Units.hh"
 #include "TimingArc.hh"
 #include "Liberty.hh"
@@ -45,6 +43,7 @@
 #include "Search.hh"
 #include "Crpr.hh"
 #include "PathEnd.hh"
+#include "ParallelVisit.hh"
 
 namespace sta {
 
@@ -70,9 +69,6 @@ public:
   Crpr crpr(const StaState *sta);
   float uncertainty(const StaState *sta);
   float skew() const { return skew_; }
-  static bool srcTgtPathNameLess(ClkSkew &clk_skew1,
-                                 ClkSkew &clk_skew2,
-                                 const StaState *sta);
 
 private:
   float clkTreeDelay(Path *clk_path,
@@ -186,21 +182,46 @@ ClkSkew::uncertainty(const StaState *sta)
                                           check_role, sta);
 }
 
-bool
-ClkSkew::srcTgtPathNameLess(ClkSkew &clk_skew1,
-                            ClkSkew &clk_skew2,
-                            const StaState *sta)
+////////////////////////////////////////////////////////////////
+
+// Worst skew for each clock found from a chunk of source registers and
+// fanout search space that is reused for each source register.
+class ClkSkewVisitor
 {
-  Network *network = sta->sdcNetwork();
-  const char *src_path1 = network->pathName(clk_skew1.srcPath()->pin(sta));
-  const char *src_path2 = network->pathName(clk_skew2.srcPath()->pin(sta));
-  const char *tgt_path1 = network->pathName(clk_skew1.tgtPath()->pin(sta));
-  const char *tgt_path2 = network->pathName(clk_skew2.tgtPath()->pin(sta));
-  return stringLess(src_path1, src_path2)
-    || (stringEqual(src_path1, src_path2)
-        && stringEqual(tgt_path1, tgt_path2));
+public:
+  ClkSkewVisitor() {}
+  ClkSkewVisitor *copy() const;
+  void merge(ClkSkewVisitor *visitor);
+  ClkSkewMap &skews() { return skews_; }
+  UnorderedSet<Vertex*> &visited() { return visited_; }
+  VertexSeq &endpoints() { return endpoints_; }
+
+private:
+  ClkSkewMap skews_;
+  UnorderedSet<Vertex*> visited_;
+  VertexSeq endpoints_;
+};
+
+ClkSkewVisitor *
+ClkSkewVisitor::copy() const
+{
+  return new ClkSkewVisitor;
 }
 
+void
+ClkSkewVisitor::merge(ClkSkewVisitor *visitor)
+{
+  // Chunks are merged in source register order, so keeping the first
+  // of equal skews matches a serial search.
+  for (auto& [clk, skew] : visitor->skews_) {
+    auto ins = skews_.insert(std::make_pair(clk, skew));
+    if (!ins.second) {
+      ClkSkew &worst_skew = ins.first->second;
+      if (abs(skew.skew()) > abs(worst_skew.skew()))
+        worst_skew = skew;
+    }
+  }
+}
 
 ////////////////////////////////////////////////////////////////
 
@@ -304,8 +325,7 @@ ClkSkews::findClkSkew(ConstClockSeq &clks,
 		      const Corner *corner,
 		      const SetupHold *setup_hold,
                       bool include_internal_latency)
-{	      
-  ClkSkewMap skews;
+{
   corner_ = corner;
   setup_hold_ = setup_hold;
   include_internal_latency_ = include_internal_latency;
@@ -314,39 +334,17 @@ ClkSkews::findClkSkew(ConstClockSeq &clks,
   for (const Clock *clk : clks)
     clk_set_.insert(clk);
 
-  if (thread_count_ > 1) {
-    std::vector<ClkSkewMap> partial_skews(thread_count_, skews);
-    for (Vertex *src_vertex : *graph_->regClkVertices()) {
-      if (hasClkPaths(src_vertex)) {
-        dispatch_queue_->dispatch([this, src_vertex, &partial_skews](int i) {
-          findClkSkewFrom(src_vertex, partial_skews[i]);
-        });
-      }
-    }
-    dispatch_queue_->finishTasks();
-
-    // Reduce skews from each register source.
-    for (size_t i = 0; i < partial_skews.size(); i++) {
-      for (auto& [clk, partial_skew] : partial_skews[i]) {
-        auto ins = skews.insert(std::make_pair(clk, partial_skew));
-        if (!ins.second) {
-          ClkSkew &final_skew = ins.first->second;
-          if (abs(partial_skew.skew()) > abs(final_skew.skew())
-              || (fuzzyEqual(abs(partial_skew.skew()), abs(final_skew.skew()))
-                  // Break ties based on source/target path names.
-                  && ClkSkew::srcTgtPathNameLess(partial_skew, final_skew, this)))
-            final_skew = partial_skew;
-        }
-      }
-    }
+  VertexSeq src_vertices;
+  for (Vertex *src_vertex : *graph_->regClkVertices()) {
+    if (hasClkPaths(src_vertex))
+      src_vertices.push_back(src_vertex);
   }
-  else {
-    for (Vertex *src_vertex : *graph_->regClkVertices()) {
-      if (hasClkPaths(src_vertex))
-        findClkSkewFrom(src_vertex, skews);
-    }
-  }
-  return skews;
+  ClkSkewVisitor visitor;
+  visitParallel<ClkSkewVisitor>(src_vertices.size(), &visitor, this,
+                                [&] (size_t index, ClkSkewVisitor *visitor1) {
+    findClkSkewFrom(src_vertices[index], visitor1);
+  });
+  return visitor.skews();
 }
 
 bool
@@ -364,7 +362,7 @@ ClkSkews::hasClkPaths(Vertex *vertex)
 
 void
 ClkSkews::findClkSkewFrom(Vertex *src_vertex,
-                          ClkSkewMap &skews)
+                          ClkSkewVisitor *visitor)
 {
   VertexOutEdgeIterator edge_iter(src_vertex, graph_);
   while (edge_iter.hasNext()) {
@@ -375,7 +373,7 @@ ClkSkews::findClkSkewFrom(Vertex *src_vertex,
       const RiseFallBoth *src_rf = rf
         ? rf->asRiseFallBoth()
         : RiseFallBoth::riseFall();
-      findClkSkewFrom(src_vertex, q_vertex, src_rf, skews);
+      findClkSkewFrom(src_vertex, q_vertex, src_rf, visitor);
     }
   }
 }
@@ -384,10 +382,11 @@ void
 ClkSkews::findClkSkewFrom(Vertex *src_vertex,
 			  Vertex *q_vertex,
 			  const RiseFallBoth *src_rf,
-			  ClkSkewMap &skews)
+			  ClkSkewVisitor *visitor)
 {
-  VertexSet endpoints = findFanout(q_vertex);
-  for (Vertex *end : endpoints) {
+  findFanout(q_vertex, visitor);
+  ClkSkewMap &skews = visitor->skews();
+  for (Vertex *end : visitor->endpoints()) {
     VertexInEdgeIterator edge_iter(end, graph_);
     while (edge_iter.hasNext()) {
       Edge *edge = edge_iter.next();
@@ -458,23 +457,26 @@ ClkSkews::findClkSkew(Vertex *src_vertex,
   }
 }
 
-VertexSet
-ClkSkews::findFanout(Vertex *from)
+void
+ClkSkews::findFanout(Vertex *from,
+                     ClkSkewVisitor *visitor)
 {
-  VertexSet endpoints(graph_);
-  UnorderedSet<Vertex*> visited;
+  UnorderedSet<Vertex*> &visited = visitor->visited();
+  VertexSeq &endpoints = visitor->endpoints();
+  visited.clear();
+  endpoints.clear();
   findFanout1(from, visited, endpoints);
-  return endpoints;
+  sort(endpoints, VertexIdLess(graph_));
 }
 
 void
 ClkSkews::findFanout1(Vertex *from,
                       UnorderedSet<Vertex*> &visited,
-                      VertexSet &endpoints)
+                      VertexSeq &endpoints)
 {
   visited.insert(from);
   if (from->hasChecks())
-    endpoints.insert(from);
+    endpoints.push_back(from);
   if (fanout_pred_.searchFrom(from)) {
     VertexOutEdgeIterator edge_iter(from, graph_);
     while (edge_iter.hasNext()) {
@@ -37,6 +37,7 @@
 namespace sta {
 
 class ClkSkew;
+class ClkSkewVisitor;
 class SearchPred;
 
 typedef std::map<const Clock*, ClkSkew> ClkSkewMap;
@@ -71,20 +72,23 @@ protected:
                          bool include_internal_latency);
   bool hasClkPaths(Vertex *vertex);
   void findClkSkewFrom(Vertex *src_vertex,
-		       ClkSkewMap &skews);
+		       ClkSkewVisitor *visitor);
   void findClkSkewFrom(Vertex *src_vertex,
 		       Vertex *q_vertex,
 		       const RiseFallBoth *src_rf,
-		       ClkSkewMap &skews);
+		       ClkSkewVisitor *visitor);
   void findClkSkew(Vertex *src_vertex,
 		   const RiseFallBoth *src_rf,
 		   Vertex *tgt_vertex,
 		   const RiseFallBoth *tgt_rf,
 		   ClkSkewMap &skews);
-  VertexSet findFanout(Vertex *from);
+  // Register check endpoints in the fanout of from in vertex id order.
+  void findFanout(Vertex *from,
+                  // Return value.
+                  ClkSkewVisitor *visitor);
   void findFanout1(Vertex *from,
                    UnorderedSet<Vertex*> &visited,
-                   VertexSet &endpoints);
+                   VertexSeq &endpoints);
   void reportClkSkew(ClkSkew &clk_skew,
                      int digits);
 
@@ -26,8 +26,10 @@
 
 #include <cmath> // abs
 #include <stdio.h>
+#include <unordered_map>
 
 #include "Debug.hh"
+#include "Hash.hh"
 #include "Vector.hh"
 #include "Network.hh"
 #include "Graph.hh"
@@ -48,11 +50,65 @@ namespace sta {
 using std::min;
 using std::abs;
 
+typedef std::pair<const Path*, const Path*> PathPair;
+
+class PathPairHash
+{
+public:
+  size_t operator()(const PathPair &paths) const
+  {
+    return hashSum(reinterpret_cast<uintptr_t>(paths.first),
+                   reinterpret_cast<uintptr_t>(paths.second));
+  }
+};
+
+// Common src/tgt clock paths keyed by the src/tgt clock paths
+// one step toward the clock source from the check pins.
+// Checks on registers driven by the same clock tree nets share the key.
+class CrprCommonPaths
+{
+public:
+  const CheckCrpr *check_crpr_;
+  size_t generation_;
+  std::unordered_map<PathPair, PathPair, PathPairHash> common_paths_;
+};
+
+// Per thread so lookups do not need locking.
+static thread_local CrprCommonPaths crpr_common_paths;
+static const size_t crpr_common_paths_max = 1 << 20;
+
+std::atomic<size_t> CheckCrpr::common_paths_generation_next_(1);
+
 CheckCrpr::CheckCrpr(StaState *sta) :
-  StaState(sta)
+  StaState(sta),
+  common_paths_generation_(common_paths_generation_next_++),
+  common_paths_hits_(0),
+  common_paths_misses_(0)
 {
 }
 
+void
+CheckCrpr::clkPathsChanged()
+{
+  common_paths_generation_ = common_paths_generation_next_++;
+}
+
+void
+CheckCrpr::commonPathsStats(// Return values.
+                            size_t &hits,
+                            size_t &misses) const
+{
+  hits = common_paths_hits_;
+  misses = common_paths_misses_;
+}
+
+void
+CheckCrpr::resetCommonPathsStats()
+{
+  common_paths_hits_ = 0;
+  common_paths_misses_ = 0;
+}
+
 // Find the maximum possible crpr (clock min/max delta delay) for a
 // path from it's ClkInfo.
 Arrival
@@ -212,12 +268,33 @@ CheckCrpr::findCrpr(const Path *src_clk_path,
   }
   const Path *src_clk_path2 = src_clk_path1;
   const Path *tgt_clk_path2 = tgt_clk_path1;
+  // Genclk src paths are not graph paths so they are not cached.
+  bool use_cache = (src_clk_path1 == src_clk_path
+                    && tgt_clk_path1 == tgt_clk_path);
+  const Path *src_cache_path = nullptr;
+  const Path *tgt_cache_path = nullptr;
+  size_t cache_generation = common_paths_generation_;
   // src_clk_path2 and tgt_clk_path2 are now in the same (gen)clk src path.
   // Use the vertex levels to back up the deeper path to see if they
   // overlap.
   int src_level = src_clk_path2->vertex(this)->level();
   int tgt_level = tgt_clk_path2->vertex(this)->level();
   while (src_clk_path2->pin(this) != tgt_clk_path2->pin(this)) {
+    if (use_cache
+        && src_clk_path2 != src_clk_path1
+        && tgt_clk_path2 != tgt_clk_path1) {
+      use_cache = false;
+      if (isGraphPath(src_clk_path2)
+          && isGraphPath(tgt_clk_path2)) {
+        src_cache_path = src_clk_path2;
+        tgt_cache_path = tgt_clk_path2;
+        if (findCommonPaths(src_cache_path, tgt_cache_path, cache_generation,
+                            src_clk_path2, tgt_clk_path2)) {
+          src_cache_path = nullptr;
+          break;
+        }
+      }
+    }
     int level_diff = src_level - tgt_level;
     if (level_diff >= 0) {
       src_clk_path2 = src_clk_path2->prevPath();
@@ -232,6 +309,9 @@ CheckCrpr::findCrpr(const Path *src_clk_path,
       tgt_level = tgt_clk_path2->vertex(this)->level();
     }
   }
+  if (src_cache_path)
+    cacheCommonPaths(src_cache_path, tgt_cache_path, cache_generation,
+                     src_clk_path2, tgt_clk_path2);
   if (src_clk_path2 && tgt_clk_path2
       && (src_clk_path2->transition(this) == tgt_clk_path2->transition(this)
 	  || same_pin)) {
@@ -242,6 +322,62 @@ CheckCrpr::findCrpr(const Path *src_clk_path,
   }
 }
 
+// Paths in the graph path arrays. Prev paths of graph paths are also
+// graph paths.
+bool
+CheckCrpr::isGraphPath(const Path *path)
+{
+  Vertex *vertex = path->vertex(this);
+  const Path *paths = graph_->paths(vertex);
+  TagGroup *tag_group = search_->tagGroup(vertex);
+  return paths
+    && tag_group
+    && path >= paths
+    && path < paths + tag_group->pathCount();
+}
+
+bool
+CheckCrpr::findCommonPaths(const Path *src_clk_path,
+                           const Path *tgt_clk_path,
+                           size_t generation,
+                           // Return values.
+                           const Path *&src_common_path,
+                           const Path *&tgt_common_path)
+{
+  CrprCommonPaths &cache = crpr_common_paths;
+  if (cache.check_crpr_ == this
+      && cache.generation_ == generation) {
+    auto itr = cache.common_paths_.find(PathPair(src_clk_path, tgt_clk_path));
+    if (itr != cache.common_paths_.end()) {
+      src_common_path = itr->second.first;
+      tgt_common_path = itr->second.second;
+      common_paths_hits_.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  common_paths_misses_.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+void
+CheckCrpr::cacheCommonPaths(const Path *src_clk_path,
+                            const Path *tgt_clk_path,
+                            size_t generation,
+                            const Path *src_common_path,
+                            const Path *tgt_common_path)
+{
+  CrprCommonPaths &cache = crpr_common_paths;
+  if (cache.check_crpr_ != this
+      || cache.generation_ != generation
+      || cache.common_paths_.size() >= crpr_common_paths_max) {
+    cache.common_paths_.clear();
+    cache.check_crpr_ = this;
+    cache.generation_ = generation;
+  }
+  cache.common_paths_[PathPair(src_clk_path, tgt_clk_path)] =
+    PathPair(src_common_path, tgt_common_path);
+}
+
 ConstPathSeq
 CheckCrpr::genClkSrcPaths(const Path *path)
 {
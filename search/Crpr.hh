@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "SdcClass.hh"
 #include "StaState.hh"
 #include "SearchClass.hh"
@@ -56,6 +58,14 @@ public:
 		       // Return values.
 		       Crpr &crpr,
 		       Pin *&crpr_pin);
+  // Clock path arrays or prev paths changed so cached common
+  // clock paths are invalid.
+  void clkPathsChanged();
+  // Common clock path cache lookups since resetCommonPathsStats.
+  void commonPathsStats(// Return values.
+                        size_t &hits,
+                        size_t &misses) const;
+  void resetCommonPathsStats();
 
 private:
   void clkPathPrev(const Path *path,
@@ -89,6 +99,24 @@ private:
   Crpr findCrpr1(const Path *src_clk_path,
 		 const Path *tgt_clk_path);
   float crprArrivalDiff(const Path *path);
+  bool isGraphPath(const Path *path);
+  bool findCommonPaths(const Path *src_clk_path,
+                       const Path *tgt_clk_path,
+                       size_t generation,
+                       // Return values.
+                       const Path *&src_common_path,
+                       const Path *&tgt_common_path);
+  void cacheCommonPaths(const Path *src_clk_path,
+                        const Path *tgt_clk_path,
+                        size_t generation,
+                        const Path *src_common_path,
+                        const Path *tgt_common_path);
+
+  // Common path cache generation, unique across CheckCrpr objects.
+  std::atomic<size_t> common_paths_generation_;
+  static std::atomic<size_t> common_paths_generation_next_;
+  std::atomic<size_t> common_paths_hits_;
+  std::atomic<size_t> common_paths_misses_;
 };
 
 } // namespace
@@ -244,6 +244,7 @@ public:
   virtual ~MakeEndTimingArcs() {}
   virtual PathEndVisitor *copy() const;
   virtual void visit(PathEnd *path_end);
+  virtual void merge(PathEndVisitor *visitor);
   void setInputRf(const RiseFall *input_rf);
   const ClockEdgeDelays &margins() const { return margins_; }
 
@@ -309,6 +310,26 @@ MakeEndTimingArcs::visit(PathEnd *path_end)
   }
 }
 
+void
+MakeEndTimingArcs::merge(PathEndVisitor *visitor)
+{
+  MakeEndTimingArcs *visitor1 = dynamic_cast<MakeEndTimingArcs*>(visitor);
+  for (const auto& [tgt_clk_edge, margins1] : visitor1->margins_) {
+    RiseFallMinMax &margins = margins_[tgt_clk_edge];
+    for (const RiseFall *rf : RiseFall::range()) {
+      for (const MinMax *min_max : MinMax::range()) {
+        float margin1, margin;
+        bool exists1, exists;
+        margins1.value(rf, min_max, margin1, exists1);
+        margins.value(rf, min_max, margin, exists);
+        // Always max margin, even for min/hold checks.
+        if (exists1)
+          margins.setValue(rf, min_max, exists ? max(margin, margin1) : margin1);
+      }
+    }
+  }
+}
+
 // input -> register setup/hold
 // input -> output combinational paths
 // Use default input arrival (set_input_delay with no clock) from inputs
@@ -353,8 +374,8 @@ MakeTimingModel::findTimingFromInput(Port *input_port)
       end_visitor.setInputRf(input_rf);
       VertexSeq endpoints = search_->filteredEndpoints();
       VisitPathEnds visit_ends(sta_);
-      for (Vertex *end : endpoints)
-        visit_ends.visitPathEnds(end, corner_, MinMaxAll::all(), true, &end_visitor);
+      visit_ends.visitPathEnds(endpoints, corner_, MinMaxAll::all(), true,
+                               &end_visitor);
       findOutputDelays(input_rf, output_delays);
       search_->deleteFilteredArrivals();
 
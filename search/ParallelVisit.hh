@@ -0,0 +1,84 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "DispatchQueue.hh"
+#include "StaState.hh"
+
+namespace sta {
+
+// Visit objects 0..count-1 on the dispatch queue threads.
+// The objects are split into contiguous chunks that are visited with
+// a copy of visitor per chunk. The chunk visitors are merged into
+// visitor in chunk order so the results match a serial walk.
+// VISITOR must define
+//   VISITOR *copy() const
+//   void merge(VISITOR *chunk_visitor)
+template <class VISITOR>
+void
+visitParallel(size_t count,
+              VISITOR *visitor,
+              const StaState *sta,
+              const std::function<void (size_t index,
+                                        VISITOR *visitor)> &visit)
+{
+  // Chunks per thread to balance uneven per object work.
+  const size_t thread_chunks = 8;
+  const size_t chunk_size_min = 64;
+  size_t thread_count = sta->threadCount();
+  size_t chunk_count = std::min(thread_count * thread_chunks,
+                                count / chunk_size_min);
+  if (thread_count > 1 && chunk_count > 1) {
+    size_t chunk_size = (count + chunk_count - 1) / chunk_count;
+    chunk_count = (count + chunk_size - 1) / chunk_size;
+    std::vector<VISITOR*> chunk_visitors(chunk_count);
+    DispatchQueue *dispatch_queue = sta->dispatchQueue();
+    for (size_t chunk = 0; chunk < chunk_count; chunk++) {
+      VISITOR *chunk_visitor = visitor->copy();
+      chunk_visitors[chunk] = chunk_visitor;
+      size_t begin = chunk * chunk_size;
+      size_t end = std::min(begin + chunk_size, count);
+      dispatch_queue->dispatch([chunk_visitor, begin, end, &visit] (int) {
+        for (size_t i = begin; i < end; i++)
+          visit(i, chunk_visitor);
+      });
+    }
+    dispatch_queue->finishTasks();
+    for (VISITOR *chunk_visitor : chunk_visitors) {
+      visitor->merge(chunk_visitor);
+      delete chunk_visitor;
+    }
+  }
+  else {
+    for (size_t i = 0; i < count; i++)
+      visit(i, visitor);
+  }
+}
+
+} // namespace
@@ -24,7 +24,10 @@
 
 #include "PathEnum.hh"
 
+#include <atomic>
+
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Error.hh"
 #include "Fuzzy.hh"
 #include "TimingRole.hh"
@@ -40,6 +43,43 @@
 
 namespace sta {
 
+// Path end shared by the diversions made from it.
+class DiversionParent
+{
+public:
+  DiversionParent(PathEnd *path_end);
+  ~DiversionParent();
+  PathEnd *pathEnd() const { return path_end_; }
+  // Caller owns the path end.
+  PathEnd *releasePathEnd();
+  void incrRefCount() { ref_count_++; }
+  // Return true when the parent is no longer referenced.
+  bool decrRefCount() { return --ref_count_ == 0; }
+
+private:
+  PathEnd *path_end_;
+  std::atomic<int> ref_count_;
+};
+
+DiversionParent::DiversionParent(PathEnd *path_end) :
+  path_end_(path_end),
+  ref_count_(0)
+{
+}
+
+DiversionParent::~DiversionParent()
+{
+  delete path_end_;
+}
+
+PathEnd *
+DiversionParent::releasePathEnd()
+{
+  PathEnd *path_end = path_end_;
+  path_end_ = nullptr;
+  return path_end;
+}
+
 // A diversion is an alternate path formed by changing the previous 
 // path/arc of before_div to after_div/div_arc in path.
 //
@@ -47,36 +87,190 @@ namespace sta {
 // after_div<--------+ 
 //                   |
 //      <--...--before_div<--...--path<---path_end
+//
+// Diversions in the queue only keep the parent path end, the diversion
+// point and the slack (or arrival) used to order them. The path end and
+// path copy are made when the diversion is popped off the queue.
 class Diversion
 {
 public:
   Diversion(PathEnd *path_end,
-	    Path *after_div);
+	    Path *after_div,
+            const StaState *sta);
+  Diversion(DiversionParent *parent,
+            Path *before_div,
+            Path *after_div,
+            Edge *div_edge,
+            TimingArc *div_arc,
+            Delay key,
+            const StaState *sta);
+  ~Diversion();
   PathEnd *pathEnd() const { return path_end_; }
   Path *divPath() const { return after_div_; }
+  Vertex *vertex() const { return vertex_; }
+  Delay key() const { return key_; }
+  // True if the diversion is slower than key.
+  bool keyWorse(Delay key,
+                const StaState *sta) const;
+  // Compare slack (or arrival) keys without the path ends.
+  int cmpKey(const Diversion *div2,
+             const StaState *sta) const;
+  // Make the diverted path end if it has not been made yet.
+  void makePathEnd(PathEnum *path_enum);
+  // Caller owns the path end.
+  PathEnd *releasePathEnd();
 
 private:
+  void setPathEnd(const PathEnd *path_end,
+                  const StaState *sta);
+  void releaseParent();
+
   PathEnd *path_end_;
+  // after_div copy in path_end_ or the search path if path_end_ is null.
   Path *after_div_;
+  DiversionParent *parent_;
+  Path *before_div_;
+  Edge *div_edge_;
+  TimingArc *div_arc_;
+  Vertex *vertex_;
+  Delay key_;
+  const MinMax *min_max_;
+  bool unconstrained_;
+  bool latch_check_;
 };
 
 Diversion::Diversion(PathEnd *path_end,
-		     Path *after_div) :
+		     Path *after_div,
+                     const StaState *sta) :
   path_end_(path_end),
-  after_div_(after_div)
+  after_div_(after_div),
+  parent_(nullptr),
+  before_div_(nullptr),
+  div_edge_(nullptr),
+  div_arc_(nullptr)
+{
+  setPathEnd(path_end, sta);
+  key_ = unconstrained_
+    ? path_end->dataArrivalTime(sta)
+    : path_end->slack(sta);
+}
+
+Diversion::Diversion(DiversionParent *parent,
+                     Path *before_div,
+                     Path *after_div,
+                     Edge *div_edge,
+                     TimingArc *div_arc,
+                     Delay key,
+                     const StaState *sta) :
+  path_end_(nullptr),
+  after_div_(after_div),
+  parent_(parent),
+  before_div_(before_div),
+  div_edge_(div_edge),
+  div_arc_(div_arc),
+  key_(key)
+{
+  parent->incrRefCount();
+  // The diverted path ends at the same vertex as the parent.
+  setPathEnd(parent->pathEnd(), sta);
+}
+
+Diversion::~Diversion()
+{
+  delete path_end_;
+  releaseParent();
+}
+
+void
+Diversion::setPathEnd(const PathEnd *path_end,
+                      const StaState *sta)
+{
+  vertex_ = path_end->vertex(sta);
+  min_max_ = path_end->minMax(sta);
+  unconstrained_ = path_end->isUnconstrained();
+  latch_check_ = path_end->isLatchCheck();
+}
+
+void
+Diversion::releaseParent()
+{
+  if (parent_ && parent_->decrRefCount())
+    delete parent_;
+  parent_ = nullptr;
+}
+
+// Same as the first comparison in PathEnd::cmp.
+// Zero when the keys are not enough to order the diversions.
+int
+Diversion::cmpKey(const Diversion *div2,
+                  const StaState *sta) const
+{
+  if (unconstrained_) {
+    if (delayEqual(key_, div2->key_))
+      return 0;
+    else if (delayLess(key_, div2->key_, min_max_, sta))
+      return 1;
+    else
+      return -1;
+  }
+  else if (delayZero(key_)
+           && delayZero(div2->key_)
+           && latch_check_
+           && div2->latch_check_)
+    // Latch borrow breaks the tie.
+    return 0;
+  else if (delayEqual(key_, div2->key_))
+    return 0;
+  else if (delayLess(key_, div2->key_, sta))
+    return -1;
+  else
+    return 1;
+}
+
+bool
+Diversion::keyWorse(Delay key,
+                    const StaState *sta) const
+{
+  if (unconstrained_)
+    return delayLess(key_, key, min_max_, sta);
+  else
+    return delayGreater(key_, key, sta);
+}
+
+void
+Diversion::makePathEnd(PathEnum *path_enum)
+{
+  if (path_end_ == nullptr) {
+    PathEnd *parent_end = parent_->pathEnd();
+    Path *div_path;
+    Path *after_div_copy;
+    path_enum->makeDivertedPath(parent_end->path(), before_div_, after_div_,
+                                div_edge_, div_arc_, div_path, after_div_copy);
+    path_end_ = parent_end->copy();
+    path_end_->setPath(div_path);
+    after_div_ = after_div_copy;
+    releaseParent();
+  }
+}
+
+PathEnd *
+Diversion::releasePathEnd()
 {
+  PathEnd *path_end = path_end_;
+  path_end_ = nullptr;
+  return path_end;
 }
 
 ////////////////////////////////////////////////////////////////
 
 // Default constructor required for DiversionQueue template.
 DiversionGreater::DiversionGreater() :
-  sta_(nullptr)
+  path_enum_(nullptr)
 {
 }
 
-DiversionGreater::DiversionGreater(const StaState *sta) :
-  sta_(sta)
+DiversionGreater::DiversionGreater(PathEnum *path_enum) :
+  path_enum_(path_enum)
 {
 }
 
@@ -87,16 +281,14 @@ bool
 DiversionGreater::operator()(Diversion *div1,
 			     Diversion *div2) const
 {
-  PathEnd *path_end1 = div1->pathEnd();
-  PathEnd *path_end2 = div2->pathEnd();
-  return PathEnd::cmp(path_end1, path_end2, sta_) > 0;
-}
-
-static void
-deleteDiversionPathEnd(Diversion *div)
-{
-  delete div->pathEnd();
-  delete div;
+  int cmp = div1->cmpKey(div2, path_enum_);
+  if (cmp == 0) {
+    // Ties are broken by the paths.
+    div1->makePathEnd(path_enum_);
+    div2->makePathEnd(path_enum_);
+    cmp = PathEnd::cmp(div1->pathEnd(), div2->pathEnd(), path_enum_);
+  }
+  return cmp > 0;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -105,16 +297,21 @@ PathEnum::PathEnum(size_t group_path_count,
 		   size_t endpoint_path_count,
 		   bool unique_pins,
 		   bool cmp_slack,
+		   bool thread_diversions,
 		   const StaState *sta) :
   StaState(sta),
   cmp_slack_(cmp_slack),
   group_path_count_(group_path_count),
   endpoint_path_count_(endpoint_path_count),
   unique_pins_(unique_pins),
-  div_queue_(DiversionGreater(sta)),
+  thread_diversions_(thread_diversions),
+  div_queue_(DiversionGreater(this)),
   div_count_(0),
   inserts_pruned_(false),
-  next_(nullptr)
+  next_(nullptr),
+  div_parent_(nullptr),
+  div_cutoff_(0.0),
+  div_cutoff_exists_(false)
 {
 }
 
@@ -128,7 +325,7 @@ PathEnum::insert(PathEnd *path_end)
              cmp_slack_ ? "slack" : "delay",
              delayAsString(cmp_slack_ ? path_end->slack(this) :
                            path_end->dataArrivalTime(this), this));
-  Diversion *div = new Diversion(path_end, path_end->path());
+  Diversion *div = new Diversion(path_end, path_end->path(), this);
   div_queue_.push(div);
   div_count_++;
 }
@@ -137,7 +334,7 @@ PathEnum::~PathEnum()
 {
   while (!div_queue_.empty()) {
     Diversion *div = div_queue_.top();
-    deleteDiversionPathEnd(div);
+    delete div;
     div_queue_.pop();
   }
   // PathEnd on deck may not have been consumed.
@@ -174,10 +371,11 @@ PathEnum::findNext()
   while (!div_queue_.empty()) {
     Diversion *div = div_queue_.top();
     div_queue_.pop();
-    PathEnd *path_end = div->pathEnd();
-    Vertex *vertex = path_end->vertex(this);
+    Vertex *vertex = div->vertex();
     path_counts_[vertex]++;
     if (debug_->check("path_enum", 2)) {
+      div->makePathEnd(this);
+      PathEnd *path_end = div->pathEnd();
       Path *path = path_end->path();
       report_->reportLine("path_enum: next path %zu %s delay %s slack %s",
                           path_counts_[vertex],
@@ -188,11 +386,24 @@ PathEnum::findNext()
     }
 
     if (path_counts_[vertex] <= endpoint_path_count_) {
+      div->makePathEnd(this);
+      PathEnd *path_end = div->releasePathEnd();
+      DiversionParent *parent = new DiversionParent(path_end);
+      // Keep the parent while pruning deletes diversions.
+      parent->incrRefCount();
+      div_parent_ = parent;
       // Add diversions for all arcs converging on the path up to the
       // diversion.
       makeDiversions(path_end, div->divPath());
-      // Caller owns the path end now, so don't delete it.
-      next_ = path_end;
+      div_parent_ = nullptr;
+      if (parent->decrRefCount()) {
+        // Caller owns the path end now, so don't delete it.
+        next_ = parent->releasePathEnd();
+        delete parent;
+      }
+      else
+        // The diversions refer to path_end, so the caller gets a copy.
+        next_ = copyPathEnd(path_end);
       delete div;
       break;
     }
@@ -202,7 +413,7 @@ PathEnum::findNext()
       debugPrint(debug_, "path_enum", 1,
 		 "endpoint_path_count reached for %s",
                  vertex->to_string(this).c_str());
-      deleteDiversionPathEnd(div);
+      delete div;
     }
   }
 }
@@ -237,6 +448,8 @@ public:
 		       bool unique_pins,
 		       PathEnum *path_enum);
   virtual VertexVisitor *copy() const override;
+  // Save diversions in divs instead of the PathEnum queue.
+  void setDiversions(DiversionSeq *divs);
   void visitFaninPathsThru(Path *before_div,
 			   Vertex *prev_vertex,
 			   TimingArc *prev_arc);
@@ -263,6 +476,13 @@ private:
 			   // Return values.
 			   PathEnd *&div_end,
 			   Path *&after_div_copy);
+  void makeDiversion(Path *after_div,
+                     Edge *div_edge,
+                     TimingArc *div_arc,
+                     const PathAnalysisPt *path_ap);
+  void makeDiversion(PathEnd *div_end,
+                     Path *after_div_copy);
+  bool divKeyFromDivSlack() const;
   bool visitEdge(const Pin *from_pin,
                  Vertex *from_vertex,
                  Edge *edge,
@@ -277,8 +497,11 @@ private:
   Path *before_div_;
   bool unique_pins_;
   PathEnum *path_enum_;
+  DiversionSeq *divs_;
 
   Slack path_end_slack_;
+  // Slack (or arrival) of path_end_ used to order diversions.
+  Delay path_end_key_;
   Tag *before_div_tag_;
   int before_div_rf_index_;
   PathAPIndex before_div_ap_index_;
@@ -286,6 +509,9 @@ private:
   TimingArc *prev_arc_;
   Vertex *prev_vertex_;
   bool crpr_active_;
+  // Find diversion keys from the diversion slack without making the
+  // diverted path end.
+  bool div_key_from_div_slack_;
   VisitedFanins visited_fanins_;
 };
 
@@ -298,6 +524,7 @@ PathEnumFaninVisitor::PathEnumFaninVisitor(PathEnd *path_end,
   before_div_(before_div),
   unique_pins_(unique_pins),
   path_enum_(path_enum),
+  divs_(nullptr),
 
   path_end_slack_(path_end->slack(this)),
   before_div_tag_(before_div_->tag(this)),
@@ -306,6 +533,34 @@ PathEnumFaninVisitor::PathEnumFaninVisitor(PathEnd *path_end,
   before_div_arrival_(before_div_->arrival()),
   crpr_active_(crprActive())
 {
+  path_end_key_ = path_end->isUnconstrained()
+    ? path_end->dataArrivalTime(this)
+    : path_end_slack_;
+  div_key_from_div_slack_ = divKeyFromDivSlack();
+}
+
+// The required time of these path ends does not depend on the data
+// path, so the diverted path slack is the path end slack less the
+// diversion slack.
+bool
+PathEnumFaninVisitor::divKeyFromDivSlack() const
+{
+  if (crpr_active_)
+    return false;
+  switch (path_end_->type()) {
+  case PathEnd::Type::unconstrained:
+  case PathEnd::Type::check:
+  case PathEnd::Type::output_delay:
+    return true;
+  default:
+    return false;
+  }
+}
+
+void
+PathEnumFaninVisitor::setDiversions(DiversionSeq *divs)
+{
+  divs_ = divs;
 }
 
 void
@@ -407,7 +662,7 @@ PathEnumFaninVisitor::visitFromToPath(const Pin *,
         makeDivertedPathEnd(from_path, edge, arc, div_end, after_div_copy);
         if (div_end) {
           reportDiversion(edge, arc, from_path);
-          path_enum_->makeDiversion(div_end, after_div_copy);
+          makeDiversion(div_end, after_div_copy);
           visited_fanins_.emplace(from_vertex, arc);
         }
       }
@@ -417,11 +672,8 @@ PathEnumFaninVisitor::visitFromToPath(const Pin *,
                    arc->to_string().c_str());
     }
     else {
-      PathEnd *div_end;
-      Path *after_div_copy;
-      makeDivertedPathEnd(from_path, edge, arc, div_end, after_div_copy);
       reportDiversion(edge, arc, from_path);
-      path_enum_->makeDiversion(div_end, after_div_copy);
+      makeDiversion(from_path, edge, arc, path_ap);
     }
   }
   return true;
@@ -446,6 +698,48 @@ PathEnumFaninVisitor::makeDivertedPathEnd(Path *after_div,
     div_end = nullptr;
 }
 
+void
+PathEnumFaninVisitor::makeDiversion(Path *after_div,
+                                    Edge *div_edge,
+                                    TimingArc *div_arc,
+                                    const PathAnalysisPt *path_ap)
+{
+  if (div_key_from_div_slack_) {
+    Arrival div_slack = path_enum_->divSlack(before_div_, after_div,
+                                             div_edge, div_arc, path_ap);
+    Delay key = (path_end_->isUnconstrained()
+                 || path_ap->pathMinMax() == MinMax::min())
+      ? path_end_key_ + div_slack
+      : path_end_key_ - div_slack;
+    // The path end is made when the diversion is popped off the queue.
+    Diversion *div = new Diversion(path_enum_->div_parent_, before_div_,
+                                   after_div, div_edge, div_arc, key, this);
+    if (divs_)
+      divs_->push_back(div);
+    else
+      path_enum_->makeDiversion(div);
+  }
+  else {
+    PathEnd *div_end;
+    Path *after_div_copy;
+    makeDivertedPathEnd(after_div, div_edge, div_arc, div_end, after_div_copy);
+    if (div_end)
+      makeDiversion(div_end, after_div_copy);
+  }
+}
+
+// Diversion with the path end that was made to find its slack.
+void
+PathEnumFaninVisitor::makeDiversion(PathEnd *div_end,
+                                    Path *after_div_copy)
+{
+  Diversion *div = new Diversion(div_end, after_div_copy, this);
+  if (divs_)
+    divs_->push_back(div);
+  else
+    path_enum_->makeDiversion(div);
+}
+
 void
 PathEnumFaninVisitor::reportDiversion(const Edge *div_edge,
                                       const TimingArc *div_arc,
@@ -482,38 +776,55 @@ PathEnumFaninVisitor::reportDiversion(const Edge *div_edge,
 //                   |
 //      <--...--before_div<--...--path<---path_end
 void
-PathEnum::makeDiversion(PathEnd *div_end,
-			Path *after_div_copy)
+PathEnum::makeDiversion(Diversion *div)
 {
-  Diversion *div = new Diversion(div_end, after_div_copy);
-  div_queue_.push(div);
-  div_count_++;
+  if (div_cutoff_exists_
+      && div->keyWorse(div_cutoff_, this))
+    // Slower than all of the diversions kept by the last prune.
+    delete div;
+  else {
+    div_queue_.push(div);
+    div_count_++;
 
-  if (div_queue_.size() > group_path_count_ * 2)
-    // We have more potenial paths than we will need.
-    pruneDiversionQueue();
+    if (div_queue_.size() > group_path_count_ * 2)
+      // We have more potenial paths than we will need.
+      pruneDiversionQueue();
+  }
 }
 
 void
 PathEnum::pruneDiversionQueue()
 {
   debugPrint(debug_, "path_enum", 2, "prune queue");
-  VertexPathCountMap path_counts;
+  // Diversions kept for each vertex.
+  VertexPathCountMap keep_counts;
   size_t end_count = 0;
-  // Collect endpoint_path_count diversions per vertex.
+  div_cutoff_exists_ = false;
+  // Collect endpoint_path_count diversions per vertex, less the paths
+  // already found for the vertex.
   DiversionSeq divs;
   while (!div_queue_.empty()) {
     Diversion *div = div_queue_.top();
-    Vertex *vertex = div->pathEnd()->vertex(this);
+    Vertex *vertex = div->vertex();
+    size_t path_count = 0;
+    bool exists;
+    path_counts_.findKey(vertex, path_count, exists);
+    size_t &keep_count = keep_counts[vertex];
     if (end_count < group_path_count_
-	&& ((unique_pins_ && path_counts[vertex] == 0)
-	    || (!unique_pins_ && path_counts[vertex] < endpoint_path_count_))) {
+        && path_count + keep_count < endpoint_path_count_
+        && (!unique_pins_ || keep_count == 0)) {
       divs.push_back(div);
-      path_counts[vertex]++;
+      keep_count++;
       end_count++;
+      if (end_count == group_path_count_) {
+        // Every kept diversion makes a path when it is popped, so later
+        // diversions slower than this one are not needed.
+        div_cutoff_ = div->key();
+        div_cutoff_exists_ = true;
+      }
     }
     else
-      deleteDiversionPathEnd(div);
+      delete div;
     div_queue_.pop();
   }
 
@@ -552,22 +863,102 @@ PathEnum::makeDiversions(PathEnd *path_end,
   Path *path = before;
   Path *prev_path = path->prevPath();
   TimingArc *prev_arc = path->prevArc(this);
-  PathEnumFaninVisitor fanin_visitor(path_end, path, unique_pins_, this);
-  while (prev_path) {
-    // Fanin visitor does all the work.
-    // While visiting the fanins the fanin_visitor finds the
-    // previous path and arc as well as diversions.
-    fanin_visitor.visitFaninPathsThru(path, prev_path->vertex(this), prev_arc);
-    // Do not enumerate beyond latch D to Q edges.
-    // This breaks latch loop paths.
-    const TimingRole *prev_role = prev_arc->role();
-    if (prev_role == TimingRole::latchDtoQ()
-        || prev_role == TimingRole::regClkToQ())
-      break;
-    path = prev_path;
-    prev_path = path->prevPath();
-    prev_arc = path->prevArc(this);
+  if (thread_diversions_ && thread_count_ > 1) {
+    PathSeq befores;
+    std::vector<TimingArc*> prev_arcs;
+    while (prev_path) {
+      befores.push_back(path);
+      prev_arcs.push_back(prev_arc);
+      const TimingRole *prev_role = prev_arc->role();
+      if (prev_role == TimingRole::latchDtoQ()
+          || prev_role == TimingRole::regClkToQ())
+        break;
+      path = prev_path;
+      prev_path = path->prevPath();
+      prev_arc = path->prevArc(this);
+    }
+    makeDiversionsThreaded(path_end, befores, prev_arcs);
+  }
+  else {
+    PathEnumFaninVisitor fanin_visitor(path_end, path, unique_pins_, this);
+    while (prev_path) {
+      // Fanin visitor does all the work.
+      // While visiting the fanins the fanin_visitor finds the
+      // previous path and arc as well as diversions.
+      fanin_visitor.visitFaninPathsThru(path, prev_path->vertex(this), prev_arc);
+      // Do not enumerate beyond latch D to Q edges.
+      // This breaks latch loop paths.
+      const TimingRole *prev_role = prev_arc->role();
+      if (prev_role == TimingRole::latchDtoQ()
+          || prev_role == TimingRole::regClkToQ())
+        break;
+      path = prev_path;
+      prev_path = path->prevPath();
+      prev_arc = path->prevArc(this);
+    }
+  }
+}
+
+// Find the diversions for each path segment in parallel and queue them
+// in path order so the results match the serial version.
+void
+PathEnum::makeDiversionsThreaded(PathEnd *path_end,
+                                 PathSeq &befores,
+                                 std::vector<TimingArc*> &prev_arcs)
+{
+  size_t before_count = befores.size();
+  std::vector<DiversionSeq> divs(before_count);
+  std::vector<PathEnumFaninVisitor> visitors(thread_count_,
+                                             PathEnumFaninVisitor(path_end,
+                                                                  befores[0],
+                                                                  unique_pins_,
+                                                                  this));
+  for (size_t i = 0; i < before_count; i++) {
+    dispatch_queue_->dispatch([&, i] (int thread) {
+      PathEnumFaninVisitor &visitor = visitors[thread];
+      Path *before = befores[i];
+      visitor.setDiversions(&divs[i]);
+      visitor.visitFaninPathsThru(before,
+                                  before->prevPath()->vertex(this),
+                                  prev_arcs[i]);
+    });
+  }
+  dispatch_queue_->finishTasks();
+
+  for (DiversionSeq &before_divs : divs) {
+    for (Diversion *div : before_divs)
+      makeDiversion(div);
+  }
+}
+
+// Copy path_end and its enumerated path.
+PathEnd *
+PathEnum::copyPathEnd(PathEnd *path_end)
+{
+  PathEnd *copy = path_end->copy();
+  Path *p = path_end->path();
+  if (p->isEnum()) {
+    Path *prev_copy = nullptr;
+    while (p) {
+      Path *path_copy = new Path(p->vertex(this),
+                                 p->tag(this),
+                                 p->arrival(),
+                                 // Replaced on next pass.
+                                 p->prevPath(),
+                                 p->prevEdge(this),
+                                 p->prevArc(this),
+                                 true, this);
+      if (prev_copy)
+        prev_copy->setPrevPath(path_copy);
+      else
+        copy->setPath(path_copy);
+      prev_copy = path_copy;
+      Path *prev = p->prevPath();
+      // Search paths are shared.
+      p = (prev && prev->isEnum()) ? prev : nullptr;
+    }
   }
+  return copy;
 }
 
 void
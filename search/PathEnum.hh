@@ -25,6 +25,7 @@
 #pragma once
 
 #include <queue>
+#include <vector>
 
 #include "Iterator.hh"
 #include "Vector.hh"
@@ -35,8 +36,10 @@
 namespace sta {
 
 class Diversion;
+class DiversionParent;
 class PathEnumFaninVisitor;
 class DiversionGreater;
+class PathEnum;
 
 typedef Vector<Diversion*> DiversionSeq;
 typedef std::priority_queue<Diversion*,DiversionSeq,
@@ -46,12 +49,12 @@ class DiversionGreater
 {
 public:
   DiversionGreater();
-  DiversionGreater(const StaState *sta);
+  DiversionGreater(PathEnum *path_enum);
   bool operator()(Diversion *div1,
 		  Diversion *div2) const;
 
 private:
-  const StaState *sta_;
+  PathEnum *path_enum_;
 };
 
 // Iterator to enumerate sucessively slower paths.
@@ -62,6 +65,8 @@ public:
 	   size_t endpoint_path_count,
 	   bool unique_pins,
 	   bool cmp_slack,
+	   // Make diversions for the path segments in parallel.
+	   bool thread_diversions,
 	   const StaState *sta);
   // Insert path ends that are enumerated in slack/arrival order.
   void insert(PathEnd *path_end);
@@ -72,8 +77,11 @@ public:
 private:
   void makeDiversions(PathEnd *path_end,
 		      Path *before);
-  void makeDiversion(PathEnd *div_end,
-		     Path *after_div_copy);
+  void makeDiversionsThreaded(PathEnd *path_end,
+                              PathSeq &befores,
+                              std::vector<TimingArc*> &prev_arcs);
+  void makeDiversion(Diversion *div);
+  PathEnd *copyPathEnd(PathEnd *path_end);
   void makeDivertedPath(Path *path,
 			Path *before_div,
 			Path *after_div,
@@ -97,14 +105,23 @@ private:
   size_t group_path_count_;
   size_t endpoint_path_count_;
   bool unique_pins_;
+  bool thread_diversions_;
   DiversionQueue div_queue_;
   int div_count_;
   // Number of paths returned for each endpoint (limit to endpoint_path_count).
   VertexPathCountMap path_counts_;
   bool inserts_pruned_;
   PathEnd *next_;
+  // Path end that diversions made by makeDiversions refer to.
+  DiversionParent *div_parent_;
+  // Slack (or arrival) of the slowest diversion kept by the last prune
+  // of a full queue.
+  Delay div_cutoff_;
+  bool div_cutoff_exists_;
 
   friend class PathEnumFaninVisitor;
+  friend class Diversion;
+  friend class DiversionGreater;
 };
 
 } // namespace
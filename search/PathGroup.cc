@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 #include "Stats.hh"
 #include "Debug.hh"
@@ -470,6 +471,15 @@ PathGroups::groupPathTo(const PathEnd *path_end) const
 
 void
 PathGroups::pushGroupPathEnds(PathEndSeq &path_ends)
+{
+  PathGroupSeq groups;
+  reportGroups(groups);
+  for (PathGroup *group : groups)
+    group->pushEnds(path_ends);
+}
+
+void
+PathGroups::reportGroups(PathGroupSeq &groups)
 {
   for (auto min_max : MinMax::range()) {
     int mm_index =  min_max->index();
@@ -477,17 +487,17 @@ PathGroups::pushGroupPathEnds(PathEndSeq &path_ends)
       const char *name = name_group.first;
       PathGroup *path_group = findPathGroup(name, min_max);
       if (path_group)
-	path_group->pushEnds(path_ends);
+	groups.push_back(path_group);
     }
 
     if (async_[mm_index])
-      async_[mm_index]->pushEnds(path_ends);
+      groups.push_back(async_[mm_index]);
 
     if (gated_clk_[mm_index])
-      gated_clk_[mm_index]->pushEnds(path_ends);
+      groups.push_back(gated_clk_[mm_index]);
 
     if (path_delay_[mm_index])
-      path_delay_[mm_index]->pushEnds(path_ends);
+      groups.push_back(path_delay_[mm_index]);
 
     ClockSeq clks;
     sdc_->sortedClocks(clks);
@@ -496,7 +506,7 @@ PathGroups::pushGroupPathEnds(PathEndSeq &path_ends)
       Clock *clk = clk_iter.next();
       PathGroup *path_group = findPathGroup(clk, min_max);
       if (path_group)
-	path_group->pushEnds(path_ends);
+	groups.push_back(path_group);
     }
   }
 }
@@ -505,7 +515,17 @@ void
 PathGroups::pushUnconstrainedPathEnds(PathEndSeq &path_ends,
 				      const MinMaxAll *min_max)
 {
-  Set<PathGroup *> groups;
+  PathGroupSeq groups;
+  unconstrainedGroups(min_max, groups);
+  for (PathGroup *group : groups)
+    group->pushEnds(path_ends);
+}
+
+void
+PathGroups::unconstrainedGroups(const MinMaxAll *min_max,
+                                PathGroupSeq &groups)
+{
+  Set<PathGroup *> group_set;
   for (auto path_ap : corners_->pathAnalysisPts()) {
     const MinMax *path_min_max = path_ap->pathMinMax();
     if (min_max->matches(path_min_max)) {
@@ -514,9 +534,9 @@ PathGroups::pushUnconstrainedPathEnds(PathEndSeq &path_ends,
       if (group
 	  // For multiple corner path APs use the same group.
 	  // Only report it once.
-	  && !groups.findKey(group)) {
-	group->pushEnds(path_ends);
-        groups.insert(group);
+	  && !group_set.findKey(group)) {
+        groups.push_back(group);
+        group_set.insert(group);
       }
     }
   }
@@ -559,6 +579,122 @@ PathGroups::makePathEnds(ExceptionTo *to,
   return path_ends;
 }
 
+void
+PathGroups::makePathEnds(ExceptionTo *to,
+                         bool unconstrained_paths,
+                         const Corner *corner,
+                         const MinMaxAll *min_max,
+                         const PathEndsFunc &func)
+{
+  Stats stats(debug_, report_);
+  // Visit the endpoints for each group so only one group holds
+  // path ends at a time.
+  PathGroupSeq groups;
+  reportGroups(groups);
+  bool found = false;
+  for (PathGroup *group : groups) {
+    makeEndpointPathEnds(to, corner, min_max, group);
+    found |= streamGroupPathEnds(group, true, func);
+  }
+
+  if (unconstrained_paths
+      && !found) {
+    // No constrained paths, so report unconstrained paths.
+    PathGroupSeq unconstrained_groups;
+    unconstrainedGroups(min_max, unconstrained_groups);
+    for (PathGroup *group : unconstrained_groups) {
+      makeEndpointPathEnds(to, corner, min_max, group);
+      streamGroupPathEnds(group, false, func);
+    }
+  }
+  stats.report("Make path ends");
+}
+
+// Path ends are passed to func in chunks of at least this size so
+// the enumerated paths are not all held at once.
+static constexpr size_t stream_chunk_size = 1024;
+
+// Compare the slack (arrival for unconstrained paths) that PathEnum
+// orders path ends by.
+static int
+pathEndCmpEnum(const PathEnd *path_end1,
+               const PathEnd *path_end2,
+               const StaState *sta)
+{
+  return path_end1->isUnconstrained()
+    ? -PathEnd::cmpArrival(path_end1, path_end2, sta)
+    : PathEnd::cmpSlack(path_end1, path_end2, sta);
+}
+
+// Return true if the group has path ends.
+// func owns the path ends it is passed.
+bool
+PathGroups::streamGroupPathEnds(PathGroup *group,
+                                bool cmp_slack,
+                                const PathEndsFunc &func)
+{
+  bool found = false;
+  if (endpoint_path_count_ == 1) {
+    PathEndSeq group_ends;
+    group->pushEnds(group_ends);
+    group->clear();
+    found = !group_ends.empty();
+    PathEndSeq path_ends;
+    for (PathEnd *end : group_ends) {
+      path_ends.push_back(end);
+      if (path_ends.size() == stream_chunk_size) {
+        func(path_ends);
+        path_ends.clear();
+      }
+    }
+    if (!path_ends.empty())
+      func(path_ends);
+  }
+  else {
+    PathEnum path_enum(group_path_count_, endpoint_path_count_,
+                       unique_pins_, cmp_slack, thread_count_ > 1, this);
+    PathGroupIterator *end_iter = group->iterator();
+    while (end_iter->hasNext()) {
+      PathEnd *end = end_iter->next();
+      if (group->saveable(end)
+          || group->enumMinSlackUnderMin(end))
+        path_enum.insert(end);
+      else
+        delete end;
+    }
+    delete end_iter;
+    group->clear();
+
+    // PathEnum returns path ends in slack order but ties are not in
+    // report order. Chunks end between different slacks and are
+    // sorted so the paths are reported in the same order as the
+    // sorted group.
+    PathEndLess path_end_less(this);
+    PathEndSeq path_ends;
+    for (int n = 0; path_enum.hasNext() && n < group_path_count_; n++) {
+      PathEnd *end = path_enum.next();
+      if (group->saveable(end)) {
+        if (path_ends.size() >= stream_chunk_size
+            && pathEndCmpEnum(path_ends.back(), end, this) < 0) {
+          sort(path_ends, path_end_less);
+          func(path_ends);
+          path_ends.clear();
+          found = true;
+        }
+        path_ends.push_back(end);
+      }
+      else
+        delete end;
+    }
+    if (!path_ends.empty()) {
+      sort(path_ends, path_end_less);
+      func(path_ends);
+      found = true;
+    }
+  }
+  return found;
+}
+
 ////////////////////////////////////////////////////////////////
 
 // Visit each path end for a vertex and add the worst one in each
@@ -566,7 +702,8 @@ PathGroups::makePathEnds(ExceptionTo *to,
 class MakePathEnds1 : public PathEndVisitor
 {
 public:
-  MakePathEnds1(PathGroups *path_groups);
+  MakePathEnds1(PathGroup *only_group,
+                PathGroups *path_groups);
   MakePathEnds1(const MakePathEnds1&) = default;
   virtual PathEndVisitor *copy() const;
   virtual void visit(PathEnd *path_end);
@@ -576,12 +713,16 @@ private:
   void visitPathEnd(PathEnd *path_end,
 		    PathGroup *group);
 
+  // Only save path ends in this group if non-null.
+  PathGroup *only_group_;
   PathGroups *path_groups_;
   PathGroupEndMap ends_;
   PathEndLess cmp_;
 };
 
-MakePathEnds1::MakePathEnds1(PathGroups *path_groups) :
+MakePathEnds1::MakePathEnds1(PathGroup *only_group,
+                             PathGroups *path_groups) :
+  only_group_(only_group),
   path_groups_(path_groups),
   cmp_(path_groups)
 {
@@ -597,7 +738,8 @@ void
 MakePathEnds1::visit(PathEnd *path_end)
 {
   PathGroup *group = path_groups_->pathGroup(path_end);
-  if (group)
+  if (group
+      && (only_group_ == nullptr || group == only_group_))
     visitPathEnd(path_end, group);
 }
 
@@ -646,6 +788,7 @@ class MakePathEndsAll : public PathEndVisitor
 {
 public:
   MakePathEndsAll(int endpoint_path_count,
+                  PathGroup *only_group,
                   PathGroups *path_groups);
   MakePathEndsAll(const MakePathEndsAll&) = default;
   virtual ~MakePathEndsAll();
@@ -658,6 +801,8 @@ private:
 		    PathGroup *group);
 
   int endpoint_path_count_;
+  // Only save path ends in this group if non-null.
+  PathGroup *only_group_;
   PathGroups *path_groups_;
   const StaState *sta_;
   PathGroupEndsMap ends_;
@@ -666,8 +811,10 @@ private:
 };
 
 MakePathEndsAll::MakePathEndsAll(int endpoint_path_count,
+                                 PathGroup *only_group,
 				 PathGroups *path_groups) :
   endpoint_path_count_(endpoint_path_count),
+  only_group_(only_group),
   path_groups_(path_groups),
   sta_(path_groups),
   slack_cmp_(path_groups),
@@ -697,7 +844,8 @@ void
 MakePathEndsAll::visit(PathEnd *path_end)
 {
   PathGroup *group = path_groups_->pathGroup(path_end);
-  if (group)
+  if (group
+      && (only_group_ == nullptr || group == only_group_))
     visitPathEnd(path_end, group);
 }
 
@@ -767,6 +915,24 @@ MakePathEndsAll::vertexEnd(Vertex *)
 
 ////////////////////////////////////////////////////////////////
 
+// Save the path ends for each endpoint in the path groups.
+// Only save path ends in only_group if it is non-null.
+void
+PathGroups::makeEndpointPathEnds(ExceptionTo *to,
+                                 const Corner *corner,
+                                 const MinMaxAll *min_max,
+                                 PathGroup *only_group)
+{
+  if (endpoint_path_count_ == 1) {
+    MakePathEnds1 make_path_ends(only_group, this);
+    makeGroupPathEnds(to, corner, min_max, &make_path_ends);
+  }
+  else {
+    MakePathEndsAll make_path_ends(endpoint_path_count_, only_group, this);
+    makeGroupPathEnds(to, corner, min_max, &make_path_ends);
+  }
+}
+
 void
 PathGroups::makeGroupPathEnds(ExceptionTo *to,
 			      int group_path_count,
@@ -775,41 +941,55 @@ PathGroups::makeGroupPathEnds(ExceptionTo *to,
 			      const Corner *corner,
 			      const MinMaxAll *min_max)
 {
-  if (endpoint_path_count == 1) {
-    MakePathEnds1 make_path_ends(this);
-    makeGroupPathEnds(to, corner, min_max, &make_path_ends);
-  }
-  else {
-    MakePathEndsAll make_path_ends(endpoint_path_count, this);
-    makeGroupPathEnds(to, corner, min_max, &make_path_ends);
-
+  makeEndpointPathEnds(to, corner, min_max, nullptr);
+  if (endpoint_path_count > 1) {
+    // Groups with their comparison (slack or delay).
+    std::vector<std::pair<PathGroup*, bool>> groups;
     for (auto path_min_max : MinMax::range()) {
       int mm_index =  path_min_max->index();
       for (auto name_group : sdc_->groupPaths()) {
         const char *name = name_group.first;
         PathGroup *group = findPathGroup(name, path_min_max);
         if (group)
-          enumPathEnds(group, group_path_count, endpoint_path_count, unique_pins, true);
+          groups.push_back({group, true});
       }
 
       for (auto clk : sdc_->clks()) {
 	PathGroup *group = findPathGroup(clk, path_min_max);
 	if (group)
-	  enumPathEnds(group, group_path_count, endpoint_path_count, unique_pins, true);
+          groups.push_back({group, true});
       }
 
       PathGroup *group = unconstrained_[mm_index];
       if (group)
-	enumPathEnds(group, group_path_count, endpoint_path_count, unique_pins, false);
+        groups.push_back({group, false});
       group = path_delay_[mm_index];
       if (group)
-	enumPathEnds(group, group_path_count, endpoint_path_count, unique_pins, true);
+        groups.push_back({group, true});
       group = gated_clk_[mm_index];
       if (group)
-	enumPathEnds(group, group_path_count, endpoint_path_count, unique_pins, true);
+        groups.push_back({group, true});
       group = async_[mm_index];
       if (group)
-	enumPathEnds(group, group_path_count, endpoint_path_count, unique_pins, true);
+        groups.push_back({group, true});
+    }
+
+    if (thread_count_ > 1 && groups.size() > 1) {
+      // Each group has its own PathEnum and results, so the output
+      // does not depend on the order the groups finish.
+      for (auto group_cmp : groups) {
+        dispatch_queue_->dispatch([this, group_cmp, group_path_count,
+                                   endpoint_path_count, unique_pins] (int) {
+          enumPathEnds(group_cmp.first, group_path_count, endpoint_path_count,
+                       unique_pins, group_cmp.second, false);
+        });
+      }
+      dispatch_queue_->finishTasks();
+    }
+    else {
+      for (auto group_cmp : groups)
+        enumPathEnds(group_cmp.first, group_path_count, endpoint_path_count,
+                     unique_pins, group_cmp.second, thread_count_ > 1);
     }
   }
 }
@@ -819,12 +999,13 @@ PathGroups::enumPathEnds(PathGroup *group,
 			 int group_path_count,
 			 int endpoint_path_count,
 			 bool unique_pins,
-			 bool cmp_slack)
+			 bool cmp_slack,
+			 bool thread_diversions)
 {
   // Insert the worst max_path path ends in the group into a path
   // enumerator.
   PathEnum path_enum(group_path_count, endpoint_path_count,
-		     unique_pins, cmp_slack, this);
+		     unique_pins, cmp_slack, thread_diversions, this);
   PathGroupIterator *end_iter = group->iterator();
   while (end_iter->hasNext()) {
     PathEnd *end = end_iter->next();
@@ -886,87 +1067,16 @@ exceptionToEmpty(ExceptionTo *to)
 
 ////////////////////////////////////////////////////////////////
 
-class MakeEndpointPathEnds : public VertexVisitor
-{
-public:
-  MakeEndpointPathEnds(PathEndVisitor *path_end_visitor,
-		       const Corner *corner,
-		       const MinMaxAll *min_max,
-		       const StaState *sta);
-  MakeEndpointPathEnds(const MakeEndpointPathEnds &make_path_ends);
-  ~MakeEndpointPathEnds();
-  virtual VertexVisitor *copy() const;
-  virtual void visit(Vertex *vertex);
-
-private:
-  VisitPathEnds visit_path_ends_;
-  PathEndVisitor *path_end_visitor_;
-  const Corner *corner_;
-  const MinMaxAll *min_max_;
-  const StaState *sta_;
-};
-
-MakeEndpointPathEnds::MakeEndpointPathEnds(PathEndVisitor *path_end_visitor,
-					   const Corner *corner,
-					   const MinMaxAll *min_max,
-					   const StaState *sta) :
-  visit_path_ends_(sta),
-  path_end_visitor_(path_end_visitor->copy()),
-  corner_(corner),
-  min_max_(min_max),
-  sta_(sta)
-{
-}
-
-MakeEndpointPathEnds::MakeEndpointPathEnds(const MakeEndpointPathEnds &make_path_ends) :
-  visit_path_ends_(make_path_ends.sta_),
-  path_end_visitor_(make_path_ends.path_end_visitor_->copy()),
-  corner_(make_path_ends.corner_),
-  min_max_(make_path_ends.min_max_),
-  sta_(make_path_ends.sta_)
-{
-}
-
-MakeEndpointPathEnds::~MakeEndpointPathEnds()
-{
-  delete path_end_visitor_;
-}
-
-VertexVisitor *
-MakeEndpointPathEnds::copy() const
-{
-  return new MakeEndpointPathEnds(path_end_visitor_, corner_, min_max_, sta_);
-}
-
-void
-MakeEndpointPathEnds::visit(Vertex *vertex)
-{
-  visit_path_ends_.visitPathEnds(vertex, corner_, min_max_, true, path_end_visitor_);
-}
-
-////////////////////////////////////////////////////////////////
-
 void
 PathGroups::makeGroupPathEnds(VertexSet *endpoints,
 			      const Corner *corner,
 			      const MinMaxAll *min_max,
 			      PathEndVisitor *visitor)
 {
-  if (thread_count_ == 1) {
-    MakeEndpointPathEnds end_visitor(visitor, corner, min_max, this);
-    for (auto endpoint : *endpoints)
-      end_visitor.visit(endpoint);
-  }
-  else {
-    Vector<MakeEndpointPathEnds> visitors(thread_count_,
-                                          MakeEndpointPathEnds(visitor, corner,
-                                                               min_max, this));
-    for (const auto endpoint : *endpoints) {
-      dispatch_queue_->dispatch( [endpoint, &visitors](int i)
-      { visitors[i].visit(endpoint); } );
-    }
-    dispatch_queue_->finishTasks();
-  }
+  VertexSeq endpoints1;
+  endpoints1.insert(endpoints1.end(), endpoints->begin(), endpoints->end());
+  VisitPathEnds visit_path_ends(this);
+  visit_path_ends.visitPathEnds(endpoints1, corner, min_max, true, visitor);
 }
 
 } // namespace
@@ -23,11 +23,13 @@
 // This notice may not be removed or altered from any source distribution.
 
 #include <algorithm>            // reverse
+#include <exception>
 
 #include "ReportPath.hh"
 
 #include "Report.hh"
 #include "Error.hh"
+#include "DispatchQueue.hh"
 #include "StringUtil.hh"
 #include "Fuzzy.hh"
 #include "Units.hh"
@@ -144,7 +146,9 @@ ReportPath::ReportPath(StaState *sta) :
   report_sigmas_(false),
   start_end_pt_width_(80),
   plus_zero_(nullptr),
-  minus_zero_(nullptr)
+  minus_zero_(nullptr),
+  stream_prev_end_(nullptr),
+  stream_end_(nullptr)
 {
   setDigits(2);
   makeFields();
@@ -336,15 +340,8 @@ void
 ReportPath::reportPathEnds(const PathEndSeq *ends) const
 {
   reportPathEndHeader();
-  if (ends && !ends->empty()) {
-    PathEnd *prev_end = nullptr;
-    PathEndSeq::ConstIterator end_iter(ends);
-    while (end_iter.hasNext()) {
-      PathEnd *end = end_iter.next();
-      reportPathEnd(end, prev_end, !end_iter.hasNext());
-      prev_end = end;
-    }
-  }
+  if (ends && !ends->empty())
+    reportPathEndsBatch(*ends, nullptr, true);
   else {
     if (format_ != ReportPathFormat::json)
       report_->reportLine("No paths found.");
@@ -352,6 +349,117 @@ ReportPath::reportPathEnds(const PathEndSeq *ends) const
   reportPathEndFooter();
 }
 
+// Number of paths formatted before they are printed.
+static constexpr size_t report_batch_size = 1024;
+
+// Delay calculator used to find load caps on report worker threads.
+static thread_local ArcDelayCalc *thread_arc_delay_calc = nullptr;
+
+// Report ends in order. prev_end precedes the first one and last
+// applies to the last one.
+// With multiple threads each path is formatted into its own buffer
+// and the buffers are printed in order. Each thread finds load caps
+// with its own copy of the delay calculator.
+void
+ReportPath::reportPathEndsBatch(const PathEndSeq &ends,
+                                const PathEnd *prev_end,
+                                bool last) const
+{
+  size_t end_count = ends.size();
+  if (thread_count_ > 1 && end_count > 1) {
+    std::vector<ArcDelayCalc*> arc_delay_calcs(thread_count_);
+    for (size_t i = 0; i < arc_delay_calcs.size(); i++)
+      arc_delay_calcs[i] = arc_delay_calc_->copy();
+    std::exception_ptr error = nullptr;
+    for (size_t batch = 0; batch < end_count && !error;
+         batch += report_batch_size) {
+      size_t batch_end = std::min(end_count, batch + report_batch_size);
+      std::vector<std::string> path_lines(batch_end - batch);
+      std::vector<std::exception_ptr> path_errors(batch_end - batch);
+      for (size_t i = batch; i < batch_end; i++) {
+        dispatch_queue_->dispatch([&, i] (int thread) {
+          thread_arc_delay_calc = arc_delay_calcs[thread];
+          Report::captureThreadLinesBegin(&path_lines[i - batch]);
+          try {
+            reportPathEnd(ends[i], (i == 0) ? prev_end : ends[i - 1],
+                          last && i == end_count - 1);
+          }
+          catch (...) {
+            path_errors[i - batch] = std::current_exception();
+          }
+          Report::captureThreadLinesEnd();
+          thread_arc_delay_calc = nullptr;
+        });
+      }
+      dispatch_queue_->finishTasks();
+      // Print paths up to the first error like the serial report.
+      for (size_t i = 0; i < path_lines.size(); i++) {
+        const std::string &lines = path_lines[i];
+        report_->printString(lines.c_str(), lines.size());
+        if (path_errors[i]) {
+          error = path_errors[i];
+          break;
+        }
+      }
+    }
+    for (ArcDelayCalc *arc_delay_calc : arc_delay_calcs)
+      delete arc_delay_calc;
+    if (error)
+      std::rethrow_exception(error);
+  }
+  else {
+    for (size_t i = 0; i < end_count; i++) {
+      PathEnd *end = ends[i];
+      reportPathEnd(end, prev_end, last && i == end_count - 1);
+      prev_end = end;
+    }
+  }
+}
+
+void
+ReportPath::reportPathEndsStreamBegin()
+{
+  stream_prev_end_ = nullptr;
+  stream_end_ = nullptr;
+  reportPathEndHeader();
+}
+
+void
+ReportPath::reportPathEndsStream(PathEndSeq &ends)
+{
+  if (!ends.empty()) {
+    // Report the held path end and all but the last of ends.
+    PathEndSeq report_ends;
+    if (stream_end_)
+      report_ends.push_back(stream_end_);
+    for (size_t i = 0; i < ends.size() - 1; i++)
+      report_ends.push_back(ends[i]);
+    if (!report_ends.empty()) {
+      reportPathEndsBatch(report_ends, stream_prev_end_, false);
+      // Keep the previous path end to find group changes.
+      delete stream_prev_end_;
+      for (size_t i = 0; i < report_ends.size() - 1; i++)
+        delete report_ends[i];
+      stream_prev_end_ = report_ends.back();
+    }
+    stream_end_ = ends.back();
+  }
+}
+
+void
+ReportPath::reportPathEndsStreamEnd()
+{
+  if (stream_end_)
+    reportPathEnd(stream_end_, stream_prev_end_, true);
+  else if (format_ != ReportPathFormat::json)
+    report_->reportLine("No paths found.");
+  reportPathEndFooter();
+  delete stream_prev_end_;
+  delete stream_end_;
+  stream_prev_end_ = nullptr;
+  stream_end_ = nullptr;
+}
+
 void
 ReportPath::reportPathEndHeader() const
 {
@@ -1242,7 +1350,7 @@ ReportPath::reportJson(const PathExpanded &expanded,
     if (is_driver)
       stringAppend(result, "%*s    \"capacitance\": %.3e,\n",
                    indent, "",
-                   graph_delay_calc_->loadCap(pin, rf, dcalc_ap));
+                   loadCap(pin, rf, dcalc_ap));
     stringAppend(result, "%*s    \"slew\": %.3e\n",
                  indent, "",
                  delayAsFloat(path->slew(this)));
@@ -2463,7 +2571,7 @@ ReportPath::reportPathLine(const Path *path,
     src_attr = network_->getAttribute(inst, "src");
   // Don't show capacitance field for input pins.
   if (is_driver && field_capacitance_->enabled())
-    cap = graph_delay_calc_->loadCap(pin, rf, dcalc_ap);
+    cap = loadCap(pin, rf, dcalc_ap);
   reportLine(what.c_str(), cap, slew, field_blank_,
 	     incr, time, false, early_late, rf, src_attr,
 	     line_case);
@@ -2810,7 +2918,7 @@ ReportPath::reportPath5(const Path *path,
         float cap = field_blank_;
         float fanout = field_blank_;
         if (field_capacitance_->enabled())
-          cap = graph_delay_calc_->loadCap(pin, rf, dcalc_ap);
+          cap = loadCap(pin, rf, dcalc_ap);
         if (field_fanout_->enabled())
           fanout = drvrFanout(vertex, dcalc_ap->corner(), min_max);
         const string what = descriptionField(vertex);
@@ -2934,6 +3042,22 @@ ReportPath::descriptionNet(const Pin *pin) const
   }
 }
 
+// Report worker threads do not share arc_delay_calc_.
+float
+ReportPath::loadCap(const Pin *drvr_pin,
+                    const RiseFall *rf,
+                    const DcalcAnalysisPt *dcalc_ap) const
+{
+  if (thread_arc_delay_calc) {
+    float pin_cap, wire_cap;
+    graph_delay_calc_->loadCap(drvr_pin, rf, dcalc_ap, thread_arc_delay_calc,
+                               pin_cap, wire_cap);
+    return pin_cap + wire_cap;
+  }
+  else
+    return graph_delay_calc_->loadCap(drvr_pin, rf, dcalc_ap);
+}
+
 float
 ReportPath::drvrFanout(Vertex *drvr,
                        const Corner *corner,
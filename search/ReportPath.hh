@@ -73,6 +73,12 @@ public:
 		     const PathEnd *prev_end,
                      bool last) const;
   void reportPathEnds(const PathEndSeq *ends) const;
+  // Report successive path ends without holding all of them.
+  // The path ends passed to reportPathEndsStream are owned and
+  // deleted by the report.
+  void reportPathEndsStreamBegin();
+  void reportPathEndsStream(PathEndSeq &ends);
+  void reportPathEndsStreamEnd();
   void reportPath(const Path *path) const;
 
   void reportShort(const PathEndUnconstrained *end) const;
@@ -418,6 +424,9 @@ protected:
   bool hasExtInputDriver(const Pin *pin,
 			 const RiseFall *rf,
 			 const MinMax *min_max) const;
+  float loadCap(const Pin *drvr_pin,
+                const RiseFall *rf,
+                const DcalcAnalysisPt *dcalc_ap) const;
   float drvrFanout(Vertex *drvr,
                    const Corner *corner,
 		   const MinMax *min_max) const;
@@ -456,6 +465,9 @@ protected:
 			     const InputDelay *input_delay,
 			     // Return value.
 			     Path &ref_path) const;
+  void reportPathEndsBatch(const PathEndSeq &ends,
+                           const PathEnd *prev_end,
+                           bool last) const;
   const char *asRisingFalling(const RiseFall *rf) const;
   const char *asRiseFall(const RiseFall *rf) const;
   Delay delayIncr(Delay time,
@@ -487,6 +499,10 @@ protected:
   const char *plus_zero_;
   const char *minus_zero_;
 
+  // Path end reports are delayed by one to know the last one.
+  PathEnd *stream_prev_end_;
+  PathEnd *stream_end_;
+
   static const float field_blank_;
   static const float field_skip_;
 };
@@ -26,6 +26,8 @@
 
 #include <algorithm>
 #include <cmath> // abs
+#include <map>
+#include <string>
 
 #include "Mutex.hh"
 #include "Report.hh"
@@ -263,6 +265,7 @@ Search::initVars()
   unconstrained_paths_ = false;
   crpr_path_pruning_enabled_ = true;
   crpr_approx_missing_requireds_ = true;
+  incremental_required_tolerance_ = 0.0;
 }
 
 Search::~Search()
@@ -293,6 +296,7 @@ Search::~Search()
   delete genclks_;
   delete filtered_arrivals_;
   deleteFilter();
+  exceptionToConesInvalid();
 }
 
 void
@@ -318,6 +322,7 @@ Search::clear()
   deleteTags();
   clearPendingLatchOutputs();
   deleteFilter();
+  exceptionToConesInvalid();
   genclks_->clear();
   found_downstream_clk_pins_ = false;
 }
@@ -346,6 +351,18 @@ Search::setCrprApproxMissingRequireds(bool enabled)
   crpr_approx_missing_requireds_ = enabled;
 }
 
+float
+Search::incrementalRequiredTolerance() const
+{
+  return incremental_required_tolerance_;
+}
+
+void
+Search::setIncrementalRequiredTolerance(float tol)
+{
+  incremental_required_tolerance_ = tol;
+}
+
 void
 Search::deleteTags()
 {
@@ -402,6 +419,7 @@ void
 Search::deletePaths()
 {
   debugPrint(debug_, "search", 1, "delete paths");
+  check_crpr_->clkPathsChanged();
   if (arrivals_exist_) {
     VertexIterator vertex_iter(graph_);
     while (vertex_iter.hasNext()) {
@@ -429,8 +447,11 @@ Search::deletePaths(Vertex *vertex)
   debugPrint(debug_, "search", 4, "delete paths %s",
              vertex->name(network_));
   TagGroup *tag_group = tagGroup(vertex);
-  if (tag_group)
+  if (tag_group) {
+    if (tag_group->hasClkTag())
+      check_crpr_->clkPathsChanged();
     graph_->deletePaths(vertex);
+  }
 }
 
 ////////////////////////////////////////////////////////////////
@@ -477,6 +498,42 @@ Search::findPathEnds(ExceptionFrom *from,
   return path_ends;
 }
 
+void
+Search::findPathEnds(ExceptionFrom *from,
+		     ExceptionThruSeq *thrus,
+		     ExceptionTo *to,
+		     bool unconstrained,
+		     const Corner *corner,
+		     const MinMaxAll *min_max,
+		     size_t group_path_count,
+		     size_t endpoint_path_count,
+		     bool unique_pins,
+		     float slack_min,
+		     float slack_max,
+		     PathGroupNameSet *group_names,
+		     bool setup,
+		     bool hold,
+		     bool recovery,
+		     bool removal,
+		     bool clk_gating_setup,
+		     bool clk_gating_hold,
+                     const PathEndsFunc &func)
+{
+  findFilteredArrivals(from, thrus, to, unconstrained, true);
+  if (!variables_->recoveryRemovalChecksEnabled())
+    recovery = removal = false;
+  if (!variables_->gatedClkChecksEnabled())
+    clk_gating_setup = clk_gating_hold = false;
+  makePathGroups(group_path_count, endpoint_path_count, unique_pins,
+                 slack_min, slack_max,
+                 group_names, setup, hold,
+                 recovery, removal,
+                 clk_gating_setup, clk_gating_hold);
+  ensureDownstreamClkPins();
+  path_groups_->makePathEnds(to, unconstrained_paths_, corner, min_max, func);
+  sdc_->reportClkToClkMaxCycleWarnings();
+}
+
 void
 Search::findFilteredArrivals(ExceptionFrom *from,
                              ExceptionThruSeq *thrus,
@@ -765,6 +822,8 @@ Search::arrivalsInvalid()
     clearWorstSlack();
     invalid_tns_->clear();
   }
+  // Exceptions may have changed; the cone cache is still valid.
+  exception_to_cones_.clear();
 }
 
 void
@@ -1071,6 +1130,7 @@ void
 Search::findArrivalsSeed()
 {
   if (!arrivals_seeded_) {
+    findExceptionToCones();
     genclks_->ensureInsertionDelays();
     arrival_iter_->clear();
     required_iter_->clear();
@@ -2608,13 +2668,21 @@ Search::mutateTag(Tag *from_tag,
 {
   ExceptionStateSet *new_states = nullptr;
   ExceptionStateSet *from_states = from_tag->states();
+  // Exception states only change at -thru points.
+  bool thru_pin = sdc_->isExceptionThruPin(to_pin);
   if (from_states) {
+    // Clock tags carry exception states to paths that use the clock
+    // as data so only data tags are compressed.
+    bool compress_states = variables_->tagCompression()
+      && !from_is_clk
+      && !to_is_clk;
     // Check for state changes in from_tag (but postpone copying state set).
     bool state_change = false;
     for (ExceptionState *state : *from_states) {
       ExceptionPath *exception = state->exception();
       // One edge may traverse multiple hierarchical thru pins.
-      while (state->matchesNextThru(from_pin,to_pin,to_rf,min_max,network_)) {
+      while (thru_pin
+             && state->matchesNextThru(from_pin,to_pin,to_rf,min_max,network_)) {
         // Found a -thru that we've been waiting for.
         state = state->nextState();
 	state_change = true;
@@ -2639,14 +2707,18 @@ Search::mutateTag(Tag *from_tag,
            && sdc_->isCompleteTo(state, to_pin, to_rf, min_max))
           // Kill loop tags at register clock pins.
           || (exception->isLoop()
-              && to_is_reg_clk)) {
+              && to_is_reg_clk)
+          // Drop states that can no longer reach their -to.
+          || (compress_states
+              && !exceptionToReachable(state, to_pin))) {
 	state_change = true;
         break;
       }
     }
 
     // Get the set of -thru exceptions starting at to_pin/edge.
-    sdc_->exceptionThruStates(from_pin, to_pin, to_rf, min_max, new_states);
+    if (thru_pin)
+      sdc_->exceptionThruStates(from_pin, to_pin, to_rf, min_max, new_states);
     if (new_states || state_change) {
       // Second pass to apply state changes and add updated existing
       // states to new states.
@@ -2655,7 +2727,8 @@ Search::mutateTag(Tag *from_tag,
       for (auto state : *from_states) {
 	ExceptionPath *exception = state->exception();
 	// One edge may traverse multiple hierarchical thru pins.
-	while (state->matchesNextThru(from_pin,to_pin,to_rf,min_max,network_))
+	while (thru_pin
+               && state->matchesNextThru(from_pin,to_pin,to_rf,min_max,network_))
 	  // Found a -thru that we've been waiting for.
 	  state = state->nextState();
 
@@ -2677,12 +2750,14 @@ Search::mutateTag(Tag *from_tag,
                && sdc_->isCompleteTo(state, from_pin, from_rf, min_max))
               // Kill loop tags at register clock pins.
               || (to_is_reg_clk
-                  && exception->isLoop())))
+                  && exception->isLoop())
+              || (compress_states
+                  && !exceptionToReachable(state, to_pin))))
 	  new_states->insert(state);
       }
     }
   }
-  else
+  else if (thru_pin)
     // Get the set of -thru exceptions starting at to_pin/edge.
     sdc_->exceptionThruStates(from_pin, to_pin, to_rf, min_max, new_states);
 
@@ -2705,6 +2780,105 @@ Search::mutateTag(Tag *from_tag,
   }
 }
 
+bool
+Search::exceptionToReachable(ExceptionState *state,
+                             const Pin *to_pin) const
+{
+  const ExceptionToCone *cone =
+    exception_to_cones_.findKey(state->exception());
+  return cone == nullptr
+    || std::binary_search(cone->begin(), cone->end(),
+                          network_->vertexId(to_pin));
+}
+
+// Find the cones before the arrival search so mutateTag can look them
+// up from the search threads without locking.
+void
+Search::findExceptionToCones()
+{
+  exception_to_cones_.clear();
+  if (variables_->tagCompression()) {
+    for (ExceptionPath *exception : *sdc_->exceptions()) {
+      const ExceptionToCone *cone = findExceptionToCone(exception);
+      if (cone)
+        exception_to_cones_[exception] = cone;
+    }
+    debugPrint(debug_, "tag_compression", 1, "%zu exception cones %zu shared",
+               exception_to_cones_.size(),
+               exception_to_cone_cache_.size());
+  }
+}
+
+const ExceptionToCone *
+Search::findExceptionToCone(ExceptionPath *exception)
+{
+  ExceptionTo *to = exception->to();
+  if (to == nullptr
+      || exception->isLoop()
+      || exception->isFilter()
+      // -to clocks match any endpoint clocked by them.
+      || (to->clks() && !to->clks()->empty()))
+    return nullptr;
+  PinSeq to_pins;
+  std::vector<VertexId> to_ids;
+  for (const Pin *pin : to->allPins(network_)) {
+    // Hierarchical pins do not have vertices.
+    if (graph_->pinLoadVertex(pin) == nullptr)
+      return nullptr;
+    to_pins.push_back(pin);
+    to_ids.push_back(network_->vertexId(pin));
+  }
+  std::sort(to_ids.begin(), to_ids.end());
+  ExceptionToCone *&cone = exception_to_cone_cache_[to_ids];
+  if (cone == nullptr)
+    cone = makeExceptionToCone(to_pins);
+  return cone;
+}
+
+// Pins in the fanin of to_pins. Disabled edges and constants are
+// ignored so the cone only changes with the netlist.
+ExceptionToCone *
+Search::makeExceptionToCone(const PinSeq &to_pins)
+{
+  UnorderedSet<const Pin*> visited;
+  visited.insert(to_pins.begin(), to_pins.end());
+  PinSeq queue = to_pins;
+  while (!queue.empty()) {
+    const Pin *pin = queue.back();
+    queue.pop_back();
+    Vertex *vertex, *bidirect_drvr_vertex;
+    graph_->pinVertices(pin, vertex, bidirect_drvr_vertex);
+    for (Vertex *to_vertex : {vertex, bidirect_drvr_vertex}) {
+      if (to_vertex) {
+        VertexInEdgeIterator edge_iter(to_vertex, graph_);
+        while (edge_iter.hasNext()) {
+          Edge *edge = edge_iter.next();
+          const Pin *from_pin = edge->from(graph_)->pin();
+          if (visited.insert(from_pin).second)
+            queue.push_back(from_pin);
+        }
+      }
+    }
+  }
+  ExceptionToCone *cone = new ExceptionToCone;
+  cone->reserve(visited.size());
+  for (const Pin *pin : visited)
+    cone->push_back(network_->vertexId(pin));
+  std::sort(cone->begin(), cone->end());
+  return cone;
+}
+
+void
+Search::exceptionToConesInvalid()
+{
+  exception_to_cones_.clear();
+  for (auto &to_cone : exception_to_cone_cache_)
+    delete to_cone.second;
+  exception_to_cone_cache_.clear();
+}
+
+////////////////////////////////////////////////////////////////
+
 TagGroup *
 Search::findTagGroup(TagGroupBldr *tag_bldr)
 {
@@ -2752,6 +2926,9 @@ Search::setVertexArrivals(Vertex *vertex,
     Path *prev_paths = graph_->paths(vertex);
     TagGroup *tag_group = findTagGroup(tag_bldr);
     size_t path_count = tag_group->pathCount();
+    if (tag_group->hasClkTag()
+        || (prev_tag_group && prev_tag_group->hasClkTag()))
+      check_crpr_->clkPathsChanged();
     // Reuse path array if it is the same size.
     if (prev_tag_group
 	&& path_count == prev_tag_group->pathCount()) {
@@ -3019,6 +3196,104 @@ Search::reportTags() const
                       long_hash);
 }
 
+// Tag and path counts by name.
+class TagProfile
+{
+public:
+  void add(const std::string &name,
+           size_t path_count);
+  void report(const char *title,
+              int max_count,
+              Report *report) const;
+
+private:
+  std::map<std::string, std::pair<size_t, size_t>> counts_;
+};
+
+void
+TagProfile::add(const std::string &name,
+                size_t path_count)
+{
+  std::pair<size_t, size_t> &counts = counts_[name];
+  counts.first++;
+  counts.second += path_count;
+}
+
+void
+TagProfile::report(const char *title,
+                   int max_count,
+                   Report *report) const
+{
+  if (!counts_.empty()) {
+    std::vector<std::pair<std::string, std::pair<size_t, size_t>>>
+      counts(counts_.begin(), counts_.end());
+    std::stable_sort(counts.begin(), counts.end(),
+                     [] (const auto &count1,
+                         const auto &count2) {
+                       return count1.second.first > count2.second.first;
+                     });
+    report->reportBlankLine();
+    report->reportLine("%s", title);
+    report->reportLine("    Tags    Paths");
+    int count = 0;
+    for (const auto &name_counts : counts) {
+      if (count++ == max_count)
+        break;
+      report->reportLine("%8zu %8zu %s",
+                         name_counts.second.first,
+                         name_counts.second.second,
+                         name_counts.first.c_str());
+    }
+  }
+}
+
+void
+Search::reportTagProfile(int max_count) const
+{
+  // Vertex paths using each tag.
+  std::vector<size_t> tag_path_counts(tag_next_, 0);
+  VertexIterator vertex_iter(graph_);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    TagGroup *tag_group = tagGroup(vertex);
+    if (tag_group) {
+      for (auto const &tag_index : *tag_group->pathIndexMap())
+        tag_path_counts[tag_index.first->index()]++;
+    }
+  }
+
+  TagProfile clk_profile;
+  TagProfile input_delay_profile;
+  TagProfile exception_profile;
+  size_t tag_count = 0;
+  size_t state_tag_count = 0;
+  for (TagIndex i = 0; i < tag_next_; i++) {
+    Tag *tag = tags_[i];
+    if (tag) {
+      size_t path_count = tag_path_counts[i];
+      tag_count++;
+      const ClockEdge *clk_edge = tag->clkEdge();
+      clk_profile.add(clk_edge ? clk_edge->name() : "unclocked", path_count);
+      InputDelay *input_delay = tag->inputDelay();
+      if (input_delay)
+        input_delay_profile.add(network_->pathName(input_delay->pin()),
+                                path_count);
+      ExceptionStateSet *states = tag->states();
+      if (states && !states->empty()) {
+        state_tag_count++;
+        for (ExceptionState *state : *states)
+          exception_profile.add(state->exception()->asString(network_),
+                                path_count);
+      }
+    }
+  }
+  report_->reportLine("%zu tags, %zu with exception states",
+                      tag_count, state_tag_count);
+  clk_profile.report("Clock edges", max_count, report_);
+  input_delay_profile.report("Input delays", max_count, report_);
+  exception_profile.report("Exceptions", max_count, report_);
+}
+
 void
 Search::reportClkInfos() const
 {
@@ -3477,20 +3752,26 @@ RequiredCmp::requiredsSave(Vertex *vertex,
 {
   bool requireds_changed = false;
   Debug *debug = sta->debug();
+  // Changes within the tolerance are not saved or propagated to the fanin,
+  // so the saved required stays within the tolerance of the actual one.
+  float tolerance = sta->search()->incrementalRequiredTolerance();
   VertexPathIterator path_iter(vertex, sta);
   while (path_iter.hasNext()) {
     Path *path = path_iter.next();
     size_t path_index = path->pathIndex(sta);
     Required req = requireds_[path_index];
     Required &prev_req = path->required();
-    bool changed = !delayEqual(prev_req, req);
+    bool changed = !delayEqual(prev_req, req)
+      && (tolerance == 0.0
+          || !(abs(delayAsFloat(req) - delayAsFloat(prev_req)) <= tolerance));
     debugPrint(debug, "search", 3, "required %s save %s -> %s%s",
                path->to_string(sta).c_str(),
                delayAsString(prev_req, sta),
                delayAsString(req, sta),
                changed ? " changed" : "");
     requireds_changed |= changed;
-    path->setRequired(req);
+    if (changed || tolerance == 0.0)
+      path->setRequired(req);
   }
   return requireds_changed;
 }
@@ -3776,12 +4057,73 @@ Search::tnsPreamble()
   PathAPIndex path_ap_count = corners_->pathAnalysisPtCount();
   tns_.resize(path_ap_count);
   tns_slacks_.resize(path_ap_count);
-  if (tns_exists_)
+  if (tns_exists_) {
     updateInvalidTns();
+    if (debug_->check("tns_check", 1))
+      checkTotalNegativeSlacks();
+  }
   else
     findTotalNegativeSlacks();
 }
 
+bool
+Search::checkTotalNegativeSlacks()
+{
+  if (tns_exists_) {
+    wnsTnsPreamble();
+    updateInvalidTns();
+  }
+  else
+    tnsPreamble();
+  PathAPIndex path_ap_count = corners_->pathAnalysisPtCount();
+  DelayDblSeq tns(path_ap_count, 0.0);
+  std::vector<size_t> slack_mismatches(path_ap_count, 0);
+  std::vector<size_t> neg_counts(path_ap_count, 0);
+  for (Vertex *vertex : *endpoints()) {
+    SlackSeq slacks(path_ap_count);
+    wnsSlacks(vertex, slacks);
+    for (PathAPIndex i = 0; i < path_ap_count; i++) {
+      Slack slack = slacks[i];
+      if (delayLess(slack, 0.0, this)) {
+        tns[i] += slack;
+        neg_counts[i]++;
+        Slack tns_slack;
+        bool exists;
+        tns_slacks_[i].findKey(vertex, tns_slack, exists);
+        if (!exists || !delayEqual(tns_slack, slack)) {
+          debugPrint(debug_, "tns_check", 1, "slack mismatch %s %s",
+                     vertex->to_string(this).c_str(),
+                     delayAsString(slack, this));
+          slack_mismatches[i]++;
+        }
+      }
+    }
+  }
+
+  bool consistent = true;
+  for (PathAPIndex i = 0; i < path_ap_count; i++) {
+    Slack incr_tns = tns_[i];
+    Slack full_tns = tns[i];
+    float diff = abs(delayAsFloat(incr_tns) - delayAsFloat(full_tns));
+    // Allow for rounding in the running sum.
+    float tolerance = abs(delayAsFloat(full_tns)) * 1e-5;
+    if (diff > tolerance
+        || slack_mismatches[i] > 0
+        || neg_counts[i] != tns_slacks_[i].size()) {
+      report_->warn(1514, "path ap %d incremental tns %s does not match %s "
+                    "with %zu endpoint mismatches.",
+                    i,
+                    delayAsString(incr_tns, this),
+                    delayAsString(full_tns, this),
+                    slack_mismatches[i]);
+      consistent = false;
+    }
+  }
+  if (!consistent)
+    findTotalNegativeSlacks();
+  return consistent;
+}
+
 void
 Search::tnsInvalid(Vertex *vertex)
 {
@@ -3913,6 +4255,26 @@ Search::worstSlack(const Corner *corner,
   worst_slacks_->worstSlack(corner, min_max, worst_slack, worst_vertex);
 }
 
+void
+Search::worstEndpoints(const Corner *corner,
+                       const MinMax *min_max,
+                       size_t count,
+                       // Return value.
+                       VertexSeq &endpoints)
+{
+  worstSlackPreamble();
+  worst_slacks_->worstEndpoints(corner, min_max, count, endpoints);
+}
+
+size_t
+Search::endpointCount(const Corner *corner,
+                      const MinMax *min_max,
+                      Slack threshold)
+{
+  worstSlackPreamble();
+  return worst_slacks_->endpointCount(corner, min_max, threshold);
+}
+
 void
 Search::worstSlackPreamble()
 {
@@ -30,6 +30,7 @@
 #include "PathGroup.hh"
 #include "Search.hh"
 #include "search/Levelize.hh"
+#include "search/Crpr.hh"
 #include "search/ReportPath.hh"
 #include "PathExpanded.hh"
 #include "Bfs.hh"
@@ -158,6 +159,22 @@ arrivals_invalid()
   sta->arrivalsInvalid();
 }
 
+void
+report_crpr_common_path_stats()
+{
+  Sta *sta = Sta::sta();
+  size_t hits, misses;
+  sta->search()->checkCrpr()->commonPathsStats(hits, misses);
+  sta->report()->reportLine("CRPR common path cache hits %zu misses %zu",
+                            hits, misses);
+}
+
+void
+reset_crpr_common_path_stats()
+{
+  Sta::sta()->search()->checkCrpr()->resetCommonPathsStats();
+}
+
 PinSet
 startpoints()
 {
@@ -223,6 +240,27 @@ worst_slack_corner(const Corner *corner,
   return worst_slack;
 }
 
+PinSeq
+worst_endpoints_cmd(const Corner *corner,
+                    const MinMax *min_max,
+                    int count)
+{
+  VertexSeq endpoints;
+  Sta::sta()->worstEndpoints(corner, min_max, count, endpoints);
+  PinSeq pins;
+  for (Vertex *vertex : endpoints)
+    pins.push_back(vertex->pin());
+  return pins;
+}
+
+int
+endpoint_slack_count_cmd(const Corner *corner,
+                         const MinMax *min_max,
+                         Slack threshold)
+{
+  return Sta::sta()->endpointCount(corner, min_max, threshold);
+}
+
 Path *
 vertex_worst_arrival_path(Vertex *vertex,
 			  const MinMax *min_max)
@@ -287,6 +325,12 @@ report_tags()
   Sta::sta()->search()->reportTags();
 }
 
+void
+report_tag_profile_cmd(int max_count)
+{
+  Sta::sta()->search()->reportTagProfile(max_count);
+}
+
 void
 report_clk_infos()
 {
@@ -372,6 +416,77 @@ find_path_ends(ExceptionFrom *from,
   return ends;
 }
 
+void
+report_path_ends_stream(ExceptionFrom *from,
+                        ExceptionThruSeq *thrus,
+                        ExceptionTo *to,
+                        bool unconstrained,
+                        Corner *corner,
+                        const MinMaxAll *delay_min_max,
+                        int group_path_count,
+                        int endpoint_path_count,
+                        bool unique_pins,
+                        float slack_min,
+                        float slack_max,
+                        bool sort_by_slack,
+                        PathGroupNameSet *groups,
+                        bool setup,
+                        bool hold,
+                        bool recovery,
+                        bool removal,
+                        bool clk_gating_setup,
+                        bool clk_gating_hold)
+{
+  Sta *sta = Sta::sta();
+  sta->reportPathEndsStream(from, thrus, to, unconstrained,
+                            corner, delay_min_max,
+                            group_path_count, endpoint_path_count,
+                            unique_pins,
+                            slack_min, slack_max,
+                            sort_by_slack,
+                            groups->size() ? groups : nullptr,
+                            setup, hold,
+                            recovery, removal,
+                            clk_gating_setup, clk_gating_hold);
+  delete groups;
+}
+
+void
+write_timing_paths_cmd(const char *filename,
+                       ExceptionFrom *from,
+                       ExceptionThruSeq *thrus,
+                       ExceptionTo *to,
+                       bool unconstrained,
+                       Corner *corner,
+                       const MinMaxAll *delay_min_max,
+                       int group_path_count,
+                       int endpoint_path_count,
+                       bool unique_pins,
+                       float slack_min,
+                       float slack_max,
+                       bool sort_by_slack,
+                       PathGroupNameSet *groups,
+                       bool setup,
+                       bool hold,
+                       bool recovery,
+                       bool removal,
+                       bool clk_gating_setup,
+                       bool clk_gating_hold)
+{
+  Sta *sta = Sta::sta();
+  sta->writeTimingPaths(filename, from, thrus, to, unconstrained,
+                        corner, delay_min_max,
+                        group_path_count, endpoint_path_count,
+                        unique_pins,
+                        slack_min, slack_max,
+                        sort_by_slack,
+                        groups->size() ? groups : nullptr,
+                        setup, hold,
+                        recovery, removal,
+                        clk_gating_setup, clk_gating_hold);
+  delete groups;
+}
+
 ////////////////////////////////////////////////////////////////
 
 void
@@ -1009,6 +1124,18 @@ set_pocv_enabled(bool enabled)
   return Sta::sta()->setPocvEnabled(enabled);
 }
 
+bool
+check_total_negative_slacks()
+{
+  return Sta::sta()->checkTotalNegativeSlacks();
+}
+
+void
+set_search_incremental_tolerance(float tol)
+{
+  Sta::sta()->setIncrementalRequiredTolerance(tol);
+}
+
 float
 pocv_sigma_factor()
 {
@@ -1129,6 +1256,18 @@ set_use_default_arrival_clock(bool enable)
   Sta::sta()->setUseDefaultArrivalClock(enable);
 }
 
+bool
+tag_compression()
+{
+  return Sta::sta()->tagCompression();
+}
+
+void
+set_tag_compression(bool enable)
+{
+  Sta::sta()->setTagCompression(enable);
+}
+
 // For regression tests.
 void
 report_arrival_entries()
@@ -112,7 +112,9 @@ proc find_timing_paths { args } {
   return $path_ends
 }
 
-proc find_timing_paths_cmd { cmd args_var } {
+# With stream_cmd the path ends are passed to stream_cmd with the
+# find_path_ends arguments instead of being returned.
+proc find_timing_paths_cmd { cmd args_var { stream_cmd {} } } {
   global sta_report_unconstrained_paths
   upvar 1 $args_var args
 
@@ -227,6 +229,15 @@ proc find_timing_paths_cmd { cmd args_var } {
     }
   }
 
+  if { $stream_cmd != {} } {
+    {*}$stream_cmd $from $thrus $to $unconstrained \
+      $corner $min_max \
+      $group_path_count $endpoint_path_count $unique_pins \
+      $slack_min $slack_max \
+      $sort_by_slack $groups \
+      1 1 1 1 1 1
+    return {}
+  }
   set path_ends [find_path_ends $from $thrus $to $unconstrained \
 		   $corner $min_max \
 		   $group_path_count $endpoint_path_count $unique_pins \
@@ -238,6 +249,39 @@ proc find_timing_paths_cmd { cmd args_var } {
 
 ################################################################
 
+define_cmd_args "write_timing_paths" \
+  {[-format columnar]\
+     [-from from_list|-rise_from from_list|-fall_from from_list]\
+     [-through through_list|-rise_through through_list|-fall_through through_list]\
+     [-to to_list|-rise_to to_list|-fall_to to_list]\
+     [-unconstrained]\
+     [-path_delay min|min_rise|min_fall|max|max_rise|max_fall|min_max]\
+     [-corner corner]\
+     [-group_path_count path_count] \
+     [-endpoint_path_count path_count]\
+     [-unique_paths_to_endpoint]\
+     [-slack_max slack_max]\
+     [-slack_min slack_min]\
+     [-path_group group_name]\
+     [-sort_by_slack]\
+     filename}
+
+proc write_timing_paths { args } {
+  parse_key_args "write_timing_paths" args keys {-format} flags {} 0
+  if { [info exists keys(-format)] && $keys(-format) != "columnar" } {
+    sta_error 528 "write_timing_paths -format must be columnar."
+  }
+  if { [llength $args] < 1 } {
+    sta_error 529 "write_timing_paths missing filename."
+  }
+  set filename [file nativename [lindex $args end]]
+  set args [lrange $args 0 end-1]
+  find_timing_paths_cmd "write_timing_paths" args \
+    [list write_timing_paths_cmd $filename]
+}
+
+################################################################
+
 define_cmd_args "report_arrival" {pin}
 
 proc report_arrival { pin } {
@@ -424,13 +468,19 @@ define_cmd_args "report_checks" \
      [-fields capacitance|slew|input_pin|net|src_attr]\
      [-digits digits]\
      [-no_line_splits]\
+     [-stream]\
      [> filename] [>> filename]}
 
 proc_redirect report_checks {
   global sta_report_unconstrained_paths
+  parse_key_args "report_checks" args keys {} flags {-stream} 0
   parse_report_path_options "report_checks" args "full" 0
-  set path_ends [find_timing_paths_cmd "report_checks" args]
-  report_path_ends $path_ends
+  if { [info exists flags(-stream)] } {
+    find_timing_paths_cmd "report_checks" args report_path_ends_stream
+  } else {
+    set path_ends [find_timing_paths_cmd "report_checks" args]
+    report_path_ends $path_ends
+  }
 }
 
 ################################################################
@@ -1041,6 +1091,122 @@ proc worst_slack1 { cmd args1 } {
 
 ################################################################
 
+define_hidden_cmd_args "worst_endpoints" \
+  {[-corner corner] [-min]|[-max] count}
+
+proc worst_endpoints { args } {
+  parse_key_args "worst_endpoints" args \
+    keys {-corner} flags {-min -max}
+  check_argc_eq1 "worst_endpoints" $args
+  set corner [parse_corner_or_default keys]
+  set min_max [parse_min_max_flags flags]
+  set count [lindex $args 0]
+  check_positive_integer "count" $count
+  return [worst_endpoints_cmd $corner $min_max $count]
+}
+
+################################################################
+
+define_hidden_cmd_args "report_tag_profile" {[-max_count count]}
+
+proc report_tag_profile { args } {
+  parse_key_args "report_tag_profile" args keys {-max_count} flags {}
+  check_argc_eq0 "report_tag_profile" $args
+  set max_count 10
+  if { [info exists keys(-max_count)] } {
+    set max_count $keys(-max_count)
+    check_positive_integer "-max_count" $max_count
+  }
+  report_tag_profile_cmd $max_count
+}
+
+define_hidden_cmd_args "endpoint_slack_count" \
+  {[-corner corner] [-min]|[-max] threshold}
+
+proc endpoint_slack_count { args } {
+  parse_key_args "endpoint_slack_count" args \
+    keys {-corner} flags {-min -max}
+  check_argc_eq1 "endpoint_slack_count" $args
+  set corner [parse_corner_or_default keys]
+  set min_max [parse_min_max_flags flags]
+  set threshold [lindex $args 0]
+  check_float "threshold" $threshold
+  return [endpoint_slack_count_cmd $corner $min_max [time_ui_sta $threshold]]
+}
+
+define_hidden_cmd_args "report_endpoint_slack_histogram" \
+  {[-corner corner] [-min]|[-max] [-bins bins] [-digits digits]\
+     [-slack_min slack_min] [-slack_max slack_max]}
+
+# Bins span -slack_min to -slack_max. The defaults are the worst slack
+# and zero, so only negative slack endpoints are counted unless a range
+# is given. Endpoints outside the range are not counted.
+proc report_endpoint_slack_histogram { args } {
+  global sta_report_default_digits
+
+  parse_key_args "report_endpoint_slack_histogram" args \
+    keys {-corner -bins -digits -slack_min -slack_max} flags {-min -max}
+  check_argc_eq0 "report_endpoint_slack_histogram" $args
+  set corner [parse_corner_or_default keys]
+  set min_max [parse_min_max_flags flags]
+  set bins 10
+  if { [info exists keys(-bins)] } {
+    set bins $keys(-bins)
+    check_positive_integer "-bins" $bins
+  }
+  if { [info exists keys(-digits)] } {
+    set digits $keys(-digits)
+    check_positive_integer "-digits" $digits
+  } else {
+    set digits $sta_report_default_digits
+  }
+  if { [info exists keys(-slack_max)] } {
+    set slack_max $keys(-slack_max)
+    check_float "-slack_max" $slack_max
+    set slack_max [time_ui_sta $slack_max]
+  } else {
+    set slack_max 0.0
+  }
+  set range_exists [info exists keys(-slack_min)]
+  if { $range_exists } {
+    set slack_min $keys(-slack_min)
+    check_float "-slack_min" $slack_min
+    set slack_min [time_ui_sta $slack_min]
+    if { $slack_min >= $slack_max } {
+      sta_error 530 "-slack_min must be less than -slack_max."
+    }
+  } else {
+    set slack_min [worst_slack_corner $corner $min_max]
+  }
+  if { $slack_min >= $slack_max } {
+    report_line "No negative slack endpoints."
+  } else {
+    set bin_width [expr ($slack_max - $slack_min) / $bins]
+    if { $range_exists } {
+      set prev_count [endpoint_slack_count_cmd $corner $min_max $slack_min]
+    } else {
+      # Endpoints at the worst slack are in the first bin.
+      set prev_count 0
+    }
+    for { set i 1 } { $i <= $bins } { incr i } {
+      set bin_min [expr $slack_min + ($i - 1) * $bin_width]
+      if { $i == $bins } {
+        set bin_max $slack_max
+      } else {
+        set bin_max [expr $slack_min + $i * $bin_width]
+      }
+      set count [endpoint_slack_count_cmd $corner $min_max $bin_max]
+      report_line [format "%s %s %d" \
+                     [format_time $bin_min $digits] \
+                     [format_time $bin_max $digits] \
+                     [expr $count - $prev_count]]
+      set prev_count $count
+    }
+  }
+}
+
+################################################################
+
 define_hidden_cmd_args "worst_clock_skew" \
   {[-setup]|[-hold][-include_internal_latency]}
 
@@ -24,6 +24,8 @@
 
 #include "Sta.hh"
 
+#include <map>
+
 #include "Machine.hh"
 #include "DispatchQueue.hh"
 #include "ReportTcl.hh"
@@ -81,6 +83,7 @@
 #include "power/Power.hh"
 #include "VisitPathEnds.hh"
 #include "PathExpanded.hh"
+#include "WriteTimingPaths.hh"
 #include "MakeTimingModel.hh"
 #include "spice/WritePathSpice.hh"
 
@@ -286,7 +289,8 @@ Sta::Sta() :
   graph_sdc_annotated_(false),
   // Default to same parasitics for all corners.
   parasitics_per_corner_(false),
-  properties_(this)
+  properties_(this),
+  edit_journal_(nullptr)
 {
 }
 
@@ -570,6 +574,7 @@ Sta::~Sta()
   delete power_;
   delete equiv_cells_;
   delete dispatch_queue_;
+  delete edit_journal_;
 }
 
 void
@@ -2344,6 +2349,21 @@ Sta::setUseDefaultArrivalClock(bool enable)
   }
 }
 
+bool
+Sta::tagCompression() const
+{
+  return variables_->tagCompression();
+}
+
+void
+Sta::setTagCompression(bool enable)
+{
+  if (variables_->tagCompression() != enable) {
+    variables_->setTagCompression(enable);
+    search_->arrivalsInvalid();
+  }
+}
+
 bool
 Sta::propagateAllClocks() const
 {
@@ -2562,6 +2582,109 @@ Sta::reportPathEnds(PathEndSeq *ends)
   report_path_->reportPathEnds(ends);
 }
 
+void
+Sta::reportPathEndsStream(ExceptionFrom *from,
+                          ExceptionThruSeq *thrus,
+                          ExceptionTo *to,
+                          bool unconstrained,
+                          const Corner *corner,
+                          const MinMaxAll *min_max,
+                          int group_path_count,
+                          int endpoint_path_count,
+                          bool unique_pins,
+                          float slack_min,
+                          float slack_max,
+                          bool sort_by_slack,
+                          PathGroupNameSet *group_names,
+                          bool setup,
+                          bool hold,
+                          bool recovery,
+                          bool removal,
+                          bool clk_gating_setup,
+                          bool clk_gating_hold)
+{
+  if (sort_by_slack) {
+    // Sorting across groups needs all of the path ends.
+    PathEndSeq path_ends = findPathEnds(from, thrus, to, unconstrained,
+                                        corner, min_max,
+                                        group_path_count, endpoint_path_count,
+                                        unique_pins, slack_min, slack_max,
+                                        sort_by_slack, group_names,
+                                        setup, hold, recovery, removal,
+                                        clk_gating_setup, clk_gating_hold);
+    report_path_->reportPathEnds(&path_ends);
+  }
+  else {
+    searchPreamble();
+    report_path_->reportPathEndsStreamBegin();
+    search_->findPathEnds(from, thrus, to, unconstrained,
+                          corner, min_max, group_path_count, endpoint_path_count,
+                          unique_pins, slack_min, slack_max, group_names,
+                          setup, hold, recovery, removal,
+                          clk_gating_setup, clk_gating_hold,
+                          [this] (PathEndSeq &path_ends) {
+                            report_path_->reportPathEndsStream(path_ends);
+                          });
+    report_path_->reportPathEndsStreamEnd();
+  }
+}
+
+void
+Sta::writeTimingPaths(const char *filename,
+                      ExceptionFrom *from,
+                      ExceptionThruSeq *thrus,
+                      ExceptionTo *to,
+                      bool unconstrained,
+                      const Corner *corner,
+                      const MinMaxAll *min_max,
+                      int group_path_count,
+                      int endpoint_path_count,
+                      bool unique_pins,
+                      float slack_min,
+                      float slack_max,
+                      bool sort_by_slack,
+                      PathGroupNameSet *group_names,
+                      bool setup,
+                      bool hold,
+                      bool recovery,
+                      bool removal,
+                      bool clk_gating_setup,
+                      bool clk_gating_hold)
+{
+  if (sort_by_slack) {
+    PathEndSeq path_ends = findPathEnds(from, thrus, to, unconstrained,
+                                        corner, min_max,
+                                        group_path_count, endpoint_path_count,
+                                        unique_pins, slack_min, slack_max,
+                                        sort_by_slack, group_names,
+                                        setup, hold, recovery, removal,
+                                        clk_gating_setup, clk_gating_hold);
+    TimingPathWriter writer(filename, this);
+    writer.writePathEnds(path_ends);
+    writer.finish();
+  }
+  else {
+    searchPreamble();
+    TimingPathWriter writer(filename, this);
+    search_->findPathEnds(from, thrus, to, unconstrained,
+                          corner, min_max, group_path_count, endpoint_path_count,
+                          unique_pins, slack_min, slack_max, group_names,
+                          setup, hold, recovery, removal,
+                          clk_gating_setup, clk_gating_hold,
+                          [&writer] (PathEndSeq &path_ends) {
+                            try {
+                              writer.writePathEnds(path_ends);
+                            }
+                            catch (...) {
+                              path_ends.deleteContents();
+                              throw;
+                            }
+                            path_ends.deleteContents();
+                          });
+    writer.finish();
+  }
+}
+
 void
 Sta::reportPath(const Path *path)
 {
@@ -3110,6 +3233,7 @@ public:
   MinPeriodEndVisitor(const MinPeriodEndVisitor &) = default;
   virtual PathEndVisitor *copy() const;
   virtual void visit(PathEnd *path_end);
+  virtual void merge(PathEndVisitor *visitor);
   float minPeriod() const { return min_period_; }
 
 private:
@@ -3162,6 +3286,13 @@ MinPeriodEndVisitor::visit(PathEnd *path_end)
   }
 }
 
+void
+MinPeriodEndVisitor::merge(PathEndVisitor *visitor)
+{
+  MinPeriodEndVisitor *visitor1 = dynamic_cast<MinPeriodEndVisitor*>(visitor);
+  min_period_ = max(min_period_, visitor1->min_period_);
+}
+
 bool
 MinPeriodEndVisitor::pathIsFromInputPort(PathEnd *path_end)
 {
@@ -3179,12 +3310,15 @@ Sta::findClkMinPeriod(const Clock *clk,
 {
   searchPreamble();
   search_->findArrivals();
+  VertexSet *endpoints = search_->endpoints();
+  for (Vertex *vertex : *endpoints)
+    findRequired(vertex);
+  VertexSeq endpoints1;
+  endpoints1.insert(endpoints1.end(), endpoints->begin(), endpoints->end());
   VisitPathEnds visit_ends(this);
   MinPeriodEndVisitor min_period_visitor(clk, include_port_paths, this);
-  for (Vertex *vertex : *search_->endpoints()) {
-    findRequired(vertex);
-    visit_ends.visitPathEnds(vertex, &min_period_visitor);
-  }
+  visit_ends.visitPathEnds(endpoints1, nullptr, MinMaxAll::all(), false,
+                           &min_period_visitor);
   return min_period_visitor.minPeriod();
 }
 
@@ -3252,6 +3386,13 @@ Sta::totalNegativeSlack(const Corner *corner,
   return search_->totalNegativeSlack(corner, min_max);
 }
 
+bool
+Sta::checkTotalNegativeSlacks()
+{
+  searchPreamble();
+  return search_->checkTotalNegativeSlacks();
+}
+
 Slack
 Sta::worstSlack(const MinMax *min_max)
 {
@@ -3283,6 +3424,26 @@ Sta::worstSlack(const Corner *corner,
   return search_->worstSlack(corner, min_max, worst_slack, worst_vertex);
 }
 
+void
+Sta::worstEndpoints(const Corner *corner,
+                    const MinMax *min_max,
+                    size_t count,
+                    // Return value.
+                    VertexSeq &endpoints)
+{
+  searchPreamble();
+  search_->worstEndpoints(corner, min_max, count, endpoints);
+}
+
+size_t
+Sta::endpointCount(const Corner *corner,
+                   const MinMax *min_max,
+                   Slack threshold)
+{
+  searchPreamble();
+  return search_->endpointCount(corner, min_max, threshold);
+}
+
 ////////////////////////////////////////////////////////////////
 
 string
@@ -3340,6 +3501,12 @@ Sta::setIncrementalDelayTolerance(float tol)
   graph_delay_calc_->setIncrementalDelayTolerance(tol);
 }
 
+void
+Sta::setIncrementalRequiredTolerance(float tol)
+{
+  search_->setIncrementalRequiredTolerance(tol);
+}
+
 ArcDelay
 Sta::arcDelay(Edge *edge,
 	      TimingArc *arc,
@@ -3942,6 +4109,15 @@ Sta::reportParasiticAnnotation(bool report_unannotated,
   sta::reportParasiticAnnotation(report_unannotated, corner, this);
 }
 
+void
+Sta::reduceParasitics(const Corner *corner,
+                      const MinMaxAll *min_max)
+{
+  ensureLibLinked();
+  ensureGraph();
+  graph_delay_calc_->reduceParasitics(corner, min_max);
+}
+
 void
 Sta::findPiElmore(Pin *drvr_pin,
 		  const RiseFall *rf,
@@ -4047,6 +4223,261 @@ Sta::networkCmdEdit()
   return dynamic_cast<NetworkEdit*>(cmd_network_);
 }
 
+// Parasitic network saved before a journaled edit changes it.
+// Pin nodes are saved as instance/port so they can be found on
+// instances that are deleted and remade by the rollback.
+class JournalParasiticNode
+{
+public:
+  Instance *inst;
+  Port *port;
+  // Subnode net/id when port is null.
+  const Net *net;
+  int id;
+  float cap;
+};
+
+class JournalParasiticDevice
+{
+public:
+  size_t id;
+  float value;
+  // Indices into JournalParasiticNetwork::nodes.
+  size_t node1;
+  size_t node2;
+};
+
+class JournalParasiticNetwork
+{
+public:
+  const Net *net;
+  const ParasiticAnalysisPt *ap;
+  bool includes_pin_caps;
+  std::vector<JournalParasiticNode> nodes;
+  std::vector<JournalParasiticDevice> resistors;
+  std::vector<JournalParasiticDevice> capacitors;
+};
+
+class JournalEdit
+{
+public:
+  enum class Kind { make_instance, delete_instance, make_net, delete_net,
+                    replace_cell, connect_pin, disconnect_pin };
+
+  JournalEdit(Kind kind);
+
+  Kind kind;
+  Instance *inst;
+  Net *net;
+  Port *port;
+  // replace_cell from cell.
+  Cell *cell;
+  // delete_instance/delete_net.
+  LibertyCell *lib_cell;
+  Instance *parent;
+  string name;
+  // Parasitic networks before disconnect_pin/delete_net.
+  std::vector<JournalParasiticNetwork> parasitics;
+};
+
+JournalEdit::JournalEdit(Kind kind) :
+  kind(kind),
+  inst(nullptr),
+  net(nullptr),
+  port(nullptr),
+  cell(nullptr),
+  lib_cell(nullptr),
+  parent(nullptr)
+{
+}
+
+// Instances and nets remade by rollback in place of deleted ones.
+class JournalRemap
+{
+public:
+  Instance *instance(Instance *inst) const;
+  Net *net(const Net *net) const;
+
+  std::map<const Instance*, Instance*> instances;
+  std::map<const Net*, Net*> nets;
+};
+
+Instance *
+JournalRemap::instance(Instance *inst) const
+{
+  auto itr = instances.find(inst);
+  return (itr == instances.end()) ? inst : itr->second;
+}
+
+Net *
+JournalRemap::net(const Net *net) const
+{
+  auto itr = nets.find(net);
+  return (itr == nets.end()) ? const_cast<Net*>(net) : itr->second;
+}
+
+void
+Sta::beginEditJournal()
+{
+  if (edit_journal_)
+    report_->error(1560, "what-if edit is already in progress.");
+  edit_journal_ = new JournalEditSeq;
+}
+
+void
+Sta::commitEditJournal()
+{
+  if (edit_journal_ == nullptr)
+    report_->error(1561, "no what-if edit in progress.");
+  delete edit_journal_;
+  edit_journal_ = nullptr;
+}
+
+void
+Sta::rollbackEditJournal()
+{
+  if (edit_journal_ == nullptr)
+    report_->error(1562, "no what-if edit in progress.");
+  // The undo edits are not journaled.
+  JournalEditSeq *edits = edit_journal_;
+  edit_journal_ = nullptr;
+  debugPrint(debug_, "network_edit", 1, "rollback %zu journal edits",
+             edits->size());
+  JournalRemap remap;
+  try {
+    // Pop each edit after it is undone so a failed undo leaves the
+    // remaining edits in the journal.
+    while (!edits->empty()) {
+      undoJournalEdit(edits->back(), remap);
+      edits->pop_back();
+    }
+  }
+  catch (...) {
+    edit_journal_ = edits;
+    throw;
+  }
+  delete edits;
+}
+
+void
+Sta::undoJournalEdit(const JournalEdit &edit,
+                     JournalRemap &remap)
+{
+  NetworkEdit *network = networkCmdEdit();
+  switch (edit.kind) {
+  case JournalEdit::Kind::make_instance:
+    deleteInstance(remap.instance(edit.inst));
+    break;
+  case JournalEdit::Kind::delete_instance: {
+    Instance *inst = makeInstance(edit.name.c_str(), edit.lib_cell,
+                                  remap.instance(edit.parent));
+    remap.instances[edit.inst] = inst;
+    break;
+  }
+  case JournalEdit::Kind::make_net:
+    deleteNet(remap.net(edit.net));
+    break;
+  case JournalEdit::Kind::delete_net: {
+    Net *net = makeNet(edit.name.c_str(), remap.instance(edit.parent));
+    remap.nets[edit.net] = net;
+    restoreJournalParasitics(edit.parasitics, remap);
+    break;
+  }
+  case JournalEdit::Kind::replace_cell:
+    replaceCell(remap.instance(edit.inst), edit.cell);
+    break;
+  case JournalEdit::Kind::connect_pin: {
+    Pin *pin = network->findPin(remap.instance(edit.inst), edit.port);
+    disconnectPin(pin);
+    break;
+  }
+  case JournalEdit::Kind::disconnect_pin:
+    connectPin(remap.instance(edit.inst), edit.port, remap.net(edit.net));
+    restoreJournalParasitics(edit.parasitics, remap);
+    break;
+  }
+}
+
+// Save the parasitic networks on net so rollback can rebuild them.
+void
+Sta::saveJournalParasitics(const Net *net,
+                           JournalEdit &edit)
+{
+  if (net && parasitics_->haveParasitics()) {
+    for (ParasiticAnalysisPt *ap : corners_->parasiticAnalysisPts()) {
+      Parasitic *parasitic = parasitics_->findParasiticNetwork(net, ap);
+      if (parasitic) {
+        JournalParasiticNetwork saved;
+        saved.net = net;
+        saved.ap = ap;
+        saved.includes_pin_caps = parasitics_->includesPinCaps(parasitic);
+        std::map<const ParasiticNode*, size_t> node_indices;
+        for (ParasiticNode *node : parasitics_->nodes(parasitic)) {
+          node_indices[node] = saved.nodes.size();
+          const Pin *pin = parasitics_->pin(node);
+          if (pin)
+            saved.nodes.push_back({network_->instance(pin),
+                                   network_->port(pin), nullptr, 0,
+                                   parasitics_->nodeGndCap(node)});
+          else
+            saved.nodes.push_back({nullptr, nullptr,
+                                   parasitics_->net(node, network_),
+                                   static_cast<int>(parasitics_->netId(node)),
+                                   parasitics_->nodeGndCap(node)});
+        }
+        for (ParasiticResistor *resistor : parasitics_->resistors(parasitic))
+          saved.resistors.push_back({parasitics_->id(resistor),
+                                     parasitics_->value(resistor),
+                                     node_indices[parasitics_->node1(resistor)],
+                                     node_indices[parasitics_->node2(resistor)]});
+        for (ParasiticCapacitor *capacitor : parasitics_->capacitors(parasitic))
+          saved.capacitors.push_back({parasitics_->id(capacitor),
+                                      parasitics_->value(capacitor),
+                                      node_indices[parasitics_->node1(capacitor)],
+                                      node_indices[parasitics_->node2(capacitor)]});
+        edit.parasitics.push_back(std::move(saved));
+      }
+    }
+  }
+}
+
+// Rebuild saved parasitic networks in the order they were saved so
+// the reduced models match the ones before the edit.
+void
+Sta::restoreJournalParasitics(const std::vector<JournalParasiticNetwork> &saved_networks,
+                              const JournalRemap &remap)
+{
+  for (const JournalParasiticNetwork &saved : saved_networks) {
+    Net *net = remap.net(saved.net);
+    Parasitic *parasitic = parasitics_->makeParasiticNetwork(net,
+                                                             saved.includes_pin_caps,
+                                                             saved.ap);
+    ParasiticNodeSeq nodes;
+    nodes.reserve(saved.nodes.size());
+    for (const JournalParasiticNode &saved_node : saved.nodes) {
+      ParasiticNode *node;
+      if (saved_node.port) {
+        Pin *pin = network_->findPin(remap.instance(saved_node.inst),
+                                     saved_node.port);
+        node = parasitics_->ensureParasiticNode(parasitic, pin, network_);
+      }
+      else
+        node = parasitics_->ensureParasiticNode(parasitic,
+                                                remap.net(saved_node.net),
+                                                saved_node.id, network_);
+      parasitics_->incrCap(node, saved_node.cap);
+      nodes.push_back(node);
+    }
+    for (const JournalParasiticDevice &resistor : saved.resistors)
+      parasitics_->makeResistor(parasitic, resistor.id, resistor.value,
+                                nodes[resistor.node1], nodes[resistor.node2]);
+    for (const JournalParasiticDevice &capacitor : saved.capacitors)
+      parasitics_->makeCapacitor(parasitic, capacitor.id, capacitor.value,
+                                 nodes[capacitor.node1], nodes[capacitor.node2]);
+    delaysInvalidFromFanin(net);
+  }
+}
+
 Instance *
 Sta::makeInstance(const char *name,
 		  LibertyCell *cell,
@@ -4056,6 +4487,11 @@ Sta::makeInstance(const char *name,
   Instance *inst = network->makeInstance(cell, name, parent);
   network->makePins(inst);
   makeInstanceAfter(inst);
+  if (edit_journal_) {
+    JournalEdit edit(JournalEdit::Kind::make_instance);
+    edit.inst = inst;
+    edit_journal_->push_back(edit);
+  }
   return inst;
 }
 
@@ -4063,6 +4499,26 @@ void
 Sta::deleteInstance(Instance *inst)
 {
   NetworkEdit *network = networkCmdEdit();
+  if (edit_journal_) {
+    LibertyCell *lib_cell = network->libertyCell(inst);
+    if (!network->isLeaf(inst) || lib_cell == nullptr)
+      report_->error(1563, "delete_instance %s is not supported in a what-if edit because it is not a liberty cell instance.",
+                     sdc_network_->pathName(inst));
+    // Disconnect the pins first so rollback reconnects them.
+    InstancePinIterator *pin_iter = network->pinIterator(inst);
+    while (pin_iter->hasNext()) {
+      Pin *pin = pin_iter->next();
+      if (network->net(pin))
+        disconnectPin(pin);
+    }
+    delete pin_iter;
+    JournalEdit edit(JournalEdit::Kind::delete_instance);
+    edit.inst = inst;
+    edit.lib_cell = lib_cell;
+    edit.parent = network->parent(inst);
+    edit.name = network->name(inst);
+    edit_journal_->push_back(edit);
+  }
   deleteInstanceBefore(inst);
   network->deleteInstance(inst);
 }
@@ -4090,6 +4546,12 @@ Sta::replaceCell(Instance *inst,
 {
   NetworkEdit *network = networkCmdEdit();
   LibertyCell *from_lib_cell = network->libertyCell(inst);
+  if (edit_journal_) {
+    JournalEdit edit(JournalEdit::Kind::replace_cell);
+    edit.inst = inst;
+    edit.cell = network->cell(inst);
+    edit_journal_->push_back(edit);
+  }
   if (sta::equivCellsArcs(from_lib_cell, to_lib_cell)) {
     // Replace celll optimized for less disruption to graph
     // when ports and timing arcs are equivalent.
@@ -4111,6 +4573,11 @@ Sta::makeNet(const char *name,
   NetworkEdit *network = networkCmdEdit();
   Net *net = network->makeNet(name, parent);
   // Sta notification unnecessary.
+  if (edit_journal_) {
+    JournalEdit edit(JournalEdit::Kind::make_net);
+    edit.net = net;
+    edit_journal_->push_back(edit);
+  }
   return net;
 }
 
@@ -4118,6 +4585,28 @@ void
 Sta::deleteNet(Net *net)
 {
   NetworkEdit *network = networkCmdEdit();
+  if (edit_journal_) {
+    NetTermIterator *term_iter = network->termIterator(net);
+    bool has_terms = term_iter->hasNext();
+    delete term_iter;
+    if (has_terms)
+      report_->error(1564, "delete_net %s is not supported in a what-if edit because it is connected to a port.",
+                     sdc_network_->pathName(net));
+    // Disconnect the pins first so rollback reconnects them.
+    PinSeq pins;
+    NetPinIterator *pin_iter = network->pinIterator(net);
+    while (pin_iter->hasNext())
+      pins.push_back(pin_iter->next());
+    delete pin_iter;
+    for (const Pin *pin : pins)
+      disconnectPin(const_cast<Pin*>(pin));
+    JournalEdit edit(JournalEdit::Kind::delete_net);
+    edit.net = net;
+    edit.parent = network->instance(net);
+    edit.name = network->name(net);
+    saveJournalParasitics(net, edit);
+    edit_journal_->push_back(edit);
+  }
   deleteNetBefore(net);
   network->deleteNet(net);
 }
@@ -4130,6 +4619,12 @@ Sta::connectPin(Instance *inst,
   NetworkEdit *network = networkCmdEdit();
   Pin *pin = network->connect(inst, port, net);
   connectPinAfter(pin);
+  if (edit_journal_) {
+    JournalEdit edit(JournalEdit::Kind::connect_pin);
+    edit.inst = inst;
+    edit.port = port;
+    edit_journal_->push_back(edit);
+  }
 }
 
 void
@@ -4140,12 +4635,26 @@ Sta::connectPin(Instance *inst,
   NetworkEdit *network = networkCmdEdit();
   Pin *pin = network->connect(inst, port, net);
   connectPinAfter(pin);
+  if (edit_journal_) {
+    JournalEdit edit(JournalEdit::Kind::connect_pin);
+    edit.inst = inst;
+    edit.port = network->port(pin);
+    edit_journal_->push_back(edit);
+  }
 }
 
 void
 Sta::disconnectPin(Pin *pin)
 {
   NetworkEdit *network = networkCmdEdit();
+  if (edit_journal_) {
+    JournalEdit edit(JournalEdit::Kind::disconnect_pin);
+    edit.inst = network->instance(pin);
+    edit.net = network->net(pin);
+    edit.port = network->port(pin);
+    saveJournalParasitics(parasitics_->findParasiticNet(pin), edit);
+    edit_journal_->push_back(edit);
+  }
   disconnectPinBefore(pin);
   network->disconnectPin(pin);
 }
@@ -4341,6 +4850,11 @@ Sta::replaceCellAfter(const Instance *inst)
 	parasitics_->loadPinCapacitanceChanged(pin);
     }
     delete pin_iter;
+    if (variables_->tagCompression()) {
+      // New arcs invalidate exception states dropped upstream.
+      search_->exceptionToConesInvalid();
+      search_->arrivalsInvalid();
+    }
   }
 }
 
@@ -4386,6 +4900,11 @@ Sta::connectPinAfter(const Pin *pin)
         }
       }
     }
+    if (variables_->tagCompression()) {
+      // New edges invalidate exception states dropped upstream.
+      search_->exceptionToConesInvalid();
+      search_->arrivalsInvalid();
+    }
   }
   sdc_->connectPinAfter(pin);
   sim_->connectPinAfter(pin);
@@ -4524,6 +5043,8 @@ Sta::deleteNetBefore(const Net *net)
     delete pin_iter;
   }
   sdc_->deleteNetBefore(net);
+  // Parasitic networks are found by net so they go with it.
+  parasitics_->deleteParasiticNetworks(net);
 }
 
 void
@@ -5700,6 +6221,15 @@ Sta::power(const Instance *inst,
   return power_->power(inst, corner);
 }
 
+void
+Sta::intervalPower(const Corner *corner,
+                   // Return value.
+                   PowerResultSeq &interval_powers)
+{
+  powerPreamble();
+  power_->intervalPower(corner, interval_powers);
+}
+
 PwrActivity
 Sta::activity(const Pin *pin)
 {
@@ -40,6 +40,7 @@
 #include "Search.hh"
 #include "GatedClk.hh"
 #include "Variables.hh"
+#include "ParallelVisit.hh"
 
 namespace sta {
 
@@ -80,6 +81,19 @@ VisitPathEnds::visitPathEnds(Vertex *vertex,
   }
 }
 
+void
+VisitPathEnds::visitPathEnds(const VertexSeq &endpoints,
+			     const Corner *corner,
+			     const MinMaxAll *min_max,
+			     bool filtered,
+			     PathEndVisitor *visitor)
+{
+  visitParallel<PathEndVisitor>(endpoints.size(), visitor, this,
+                                [&] (size_t index, PathEndVisitor *visitor1) {
+    visitPathEnds(endpoints[index], corner, min_max, filtered, visitor1);
+  });
+}
+
 void
 VisitPathEnds::visitClkedPathEnds(const Pin *pin,
 				  Vertex *vertex,
@@ -31,11 +31,10 @@
 #include "Corner.hh"
 #include "Search.hh"
 #include "PathAnalysisPt.hh"
+#include "ParallelVisit.hh"
 
 namespace sta {
 
-using std::min;
-
 WorstSlacks::WorstSlacks(StaState *sta) :
   worst_slacks_(sta->corners()->pathAnalysisPtCount(), sta),
   sta_(sta)
@@ -75,6 +74,26 @@ WorstSlacks::worstSlack(const Corner *corner,
 					  worst_slack, worst_vertex);
 }
 
+void
+WorstSlacks::worstEndpoints(const Corner *corner,
+                            const MinMax *min_max,
+                            size_t count,
+                            // Return value.
+                            VertexSeq &endpoints)
+{
+  PathAPIndex path_ap_index = corner->findPathAnalysisPt(min_max)->index();
+  worst_slacks_[path_ap_index].worstEndpoints(path_ap_index, count, endpoints);
+}
+
+size_t
+WorstSlacks::endpointCount(const Corner *corner,
+                           const MinMax *min_max,
+                           Slack threshold)
+{
+  PathAPIndex path_ap_index = corner->findPathAnalysisPt(min_max)->index();
+  return worst_slacks_[path_ap_index].endpointCount(path_ap_index, threshold);
+}
+
 void
 WorstSlacks::updateWorstSlacks(Vertex *vertex,
 			       SlackSeq &slacks)
@@ -99,29 +118,18 @@ WorstSlacks::worstSlackNotifyBefore(Vertex *vertex)
 WorstSlack::WorstSlack(StaState *sta) :
   StaState(sta),
   slack_init_(MinMax::min()->initValue()),
-  worst_vertex_(nullptr),
-  worst_slack_(slack_init_),
-  slack_threshold_(slack_init_),
-  queue_(new VertexSet(graph_)),
-  min_queue_size_(10),
-  max_queue_size_(20)
+  tree_exists_(false),
+  root_(-1),
+  random_(2463534242)
 {
 }
 
-WorstSlack::~WorstSlack()
-{
-  delete queue_;
-}
-
 WorstSlack::WorstSlack(const WorstSlack &worst_slack) :
   StaState(worst_slack),
   slack_init_(MinMax::min()->initValue()),
-  worst_vertex_(nullptr),
-  worst_slack_(slack_init_),
-  slack_threshold_(slack_init_),
-  queue_(new VertexSet(graph_)),
-  min_queue_size_(10),
-  max_queue_size_(20)
+  tree_exists_(false),
+  root_(-1),
+  random_(2463534242)
 {
 }
 
@@ -129,11 +137,7 @@ void
 WorstSlack::deleteVertexBefore(Vertex *vertex)
 {
   LockGuard lock(lock_);
-  if (vertex == worst_vertex_) {
-    worst_vertex_ = nullptr;
-    worst_slack_ = slack_init_;
-  }
-  queue_->erase(vertex);
+  treeErase(vertex);
 }
 
 void
@@ -142,129 +146,123 @@ WorstSlack::worstSlack(PathAPIndex path_ap_index,
 		       Slack &worst_slack,
 		       Vertex *&worst_vertex)
 {
-  findWorstSlack(path_ap_index);
-  worst_slack = worst_slack_;
-  worst_vertex = worst_vertex_;
+  ensureTree(path_ap_index);
+  worst_slack = slack_init_;
+  worst_vertex = nullptr;
+  int node = root_;
+  while (node >= 0) {
+    const SlackTreeNode &tree_node = nodes_[node];
+    worst_slack = tree_node.slack;
+    worst_vertex = tree_node.vertex;
+    node = tree_node.left;
+  }
 }
 
 void
-WorstSlack::findWorstSlack(PathAPIndex path_ap_index)
+WorstSlack::worstEndpoints(PathAPIndex path_ap_index,
+                           size_t count,
+                           // Return value.
+                           VertexSeq &endpoints)
 {
-  if (worst_vertex_ == nullptr) {
-    if (queue_->empty())
-      initQueue(path_ap_index);
-    else
-      findWorstInQueue(path_ap_index);
+  ensureTree(path_ap_index);
+  endpoints.clear();
+  // In order traversal.
+  std::vector<int> stack;
+  int node = root_;
+  while ((node >= 0 || !stack.empty())
+         && endpoints.size() < count) {
+    while (node >= 0) {
+      stack.push_back(node);
+      node = nodes_[node].left;
+    }
+    node = stack.back();
+    stack.pop_back();
+    endpoints.push_back(nodes_[node].vertex);
+    node = nodes_[node].right;
   }
 }
 
-void
-WorstSlack::initQueue(PathAPIndex path_ap_index)
+size_t
+WorstSlack::endpointCount(PathAPIndex path_ap_index,
+                          Slack threshold)
 {
-  debugPrint(debug_, "wns", 3, "init queue");
-
-  queue_->clear();
-  worst_vertex_ = nullptr;
-  worst_slack_ = slack_init_;
-  slack_threshold_ = slack_init_;
-  for(Vertex *vertex : *search_->endpoints()) {
-    Slack slack = search_->wnsSlack(vertex, path_ap_index);
-    if (!delayEqual(slack, slack_init_)) {
-      if (delayLess(slack, worst_slack_, this))
-	setWorstSlack(vertex, slack);
-      if (delayLessEqual(slack, slack_threshold_, this))
-	queue_->insert(vertex);
-      int queue_size = queue_->size();
-      if (queue_size >= max_queue_size_)
-	sortQueue(path_ap_index);
+  ensureTree(path_ap_index);
+  size_t count = 0;
+  int node = root_;
+  while (node >= 0) {
+    const SlackTreeNode &tree_node = nodes_[node];
+    if (delayAsFloat(tree_node.slack) < delayAsFloat(threshold)) {
+      count += treeSize(tree_node.left) + 1;
+      node = tree_node.right;
     }
+    else
+      node = tree_node.left;
   }
-  debugPrint(debug_, "wns", 3, "threshold %s",
-             delayAsString(slack_threshold_, this));
-//  checkQueue();
+  return count;
 }
 
-void
-WorstSlack::sortQueue(PathAPIndex path_ap_index)
+// Find endpoint slacks on multiple threads.
+class EndpointSlackVisitor
+{
+public:
+  EndpointSlackVisitor(PathAPIndex path_ap_index,
+                       Search *search,
+                       SlackSeq &slacks);
+  EndpointSlackVisitor *copy() const;
+  // Slacks are saved by endpoint index so there is nothing to merge.
+  void merge(EndpointSlackVisitor *) {}
+  void visit(size_t index,
+             Vertex *vertex);
+
+private:
+  PathAPIndex path_ap_index_;
+  Search *search_;
+  SlackSeq &slacks_;
+};
+
+EndpointSlackVisitor::EndpointSlackVisitor(PathAPIndex path_ap_index,
+                                           Search *search,
+                                           SlackSeq &slacks) :
+  path_ap_index_(path_ap_index),
+  search_(search),
+  slacks_(slacks)
 {
-  if (queue_->size() > 0) {
-    debugPrint(debug_, "wns", 3, "sort queue");
-
-    VertexSeq vertices;
-    vertices.reserve(queue_->size());
-    for (Vertex *vertex : *queue_)
-      vertices.push_back(vertex);
-    WnsSlackLess slack_less(path_ap_index, this);
-    sort(vertices, slack_less);
-
-    int vertex_count = vertices.size();
-    int threshold_index = min(min_queue_size_, vertex_count - 1);
-    Vertex *threshold_vertex = vertices[threshold_index];
-    slack_threshold_ = search_->wnsSlack(threshold_vertex, path_ap_index);
-    debugPrint(debug_, "wns", 3, "threshold %s",
-               delayAsString(slack_threshold_, this));
-
-    // Reinsert vertices with slack < threshold.
-    queue_->clear();
-    VertexSeq::Iterator queue_iter2(vertices);
-    while (queue_iter2.hasNext()) {
-      Vertex *vertex = queue_iter2.next();
-      Slack slack = search_->wnsSlack(vertex, path_ap_index);
-      if (delayGreater(slack, slack_threshold_, this))
-	break;
-      queue_->insert(vertex);
-    }
-    max_queue_size_ = queue_->size() * 2;
-    Vertex *worst_slack_vertex = vertices[0];
-    Slack worst_slack_slack = search_->wnsSlack(worst_slack_vertex, path_ap_index);
-    setWorstSlack(worst_slack_vertex, worst_slack_slack);
-  }
 }
 
-void
-WorstSlack::findWorstInQueue(PathAPIndex path_ap_index)
+EndpointSlackVisitor *
+EndpointSlackVisitor::copy() const
 {
-  debugPrint(debug_, "wns", 3, "find worst in queue");
-
-  worst_vertex_ = nullptr;
-  worst_slack_ = slack_init_;
-  for (Vertex *vertex : *queue_) {
-    Slack slack = search_->wnsSlack(vertex, path_ap_index);
-    if (delayLess(slack, worst_slack_, this))
-      setWorstSlack(vertex, slack);
-  }
+  return new EndpointSlackVisitor(path_ap_index_, search_, slacks_);
 }
 
 void
-WorstSlack::checkQueue(PathAPIndex path_ap_index)
+EndpointSlackVisitor::visit(size_t index,
+                            Vertex *vertex)
 {
-  VertexSeq ends;
-  for(Vertex *end : *search_->endpoints()) {
-    if (delayLessEqual(search_->wnsSlack(end, path_ap_index),
-		       slack_threshold_, this))
-      ends.push_back(end);
-  }
-  WnsSlackLess slack_less(path_ap_index, this);
-  sort(ends, slack_less);
-
-  VertexSet end_set(graph_);
-  for (Vertex *end : ends) {
-    end_set.insert(end);
-    if (!queue_->hasKey(end)
-	&& delayLessEqual(search_->wnsSlack(end, path_ap_index),
-			  slack_threshold_, this))
-      report_->reportLine("WorstSlack queue missing %s %s < %s",
-                          end->to_string(this).c_str(),
-                          delayAsString(search_->wnsSlack(end, path_ap_index), this),
-                          delayAsString(slack_threshold_, this));
-  }
+  slacks_[index] = search_->wnsSlack(vertex, path_ap_index_);
+}
 
-  for (Vertex *end : *queue_) {
-    if (!end_set.hasKey(end))
-      report_->reportLine("WorstSlack queue extra %s %s > %s",
-                          end->to_string(this).c_str(),
-                          delayAsString(search_->wnsSlack(end, path_ap_index), this),
-                          delayAsString(slack_threshold_, this));
+void
+WorstSlack::ensureTree(PathAPIndex path_ap_index)
+{
+  if (!tree_exists_) {
+    debugPrint(debug_, "wns", 3, "init slack tree");
+    VertexSet *endpoint_set = search_->endpoints();
+    VertexSeq endpoints;
+    endpoints.insert(endpoints.end(), endpoint_set->begin(), endpoint_set->end());
+    SlackSeq slacks(endpoints.size());
+    EndpointSlackVisitor slack_visitor(path_ap_index, search_, slacks);
+    visitParallel<EndpointSlackVisitor>(endpoints.size(), &slack_visitor, this,
+                                        [&] (size_t index,
+                                             EndpointSlackVisitor *visitor) {
+      visitor->visit(index, endpoints[index]);
+    });
+    for (size_t i = 0; i < endpoints.size(); i++) {
+      Slack slack = slacks[i];
+      if (!delayEqual(slack, slack_init_))
+        treeInsert(endpoints[i], slack);
+    }
+    tree_exists_ = true;
   }
 }
 
@@ -273,63 +271,143 @@ WorstSlack::updateWorstSlack(Vertex *vertex,
 			     SlackSeq &slacks,
 			     PathAPIndex path_ap_index)
 {
-  // Do not touch the state unless queue has been initialized
-  if (!queue_->empty()) {
+  // Do not touch the state unless the tree has been initialized.
+  if (tree_exists_) {
     Slack slack = slacks[path_ap_index];
     // Locking is required because ArrivalVisitor is called by multiple
     // threads.
     LockGuard lock(lock_);
-    if (worst_vertex_
-        && delayLess(slack, worst_slack_, this))
-      setWorstSlack(vertex, slack);
-    else if (vertex == worst_vertex_)
-      // Mark worst slack as unknown (updated by findWorstSlack().
-      worst_vertex_ = nullptr;
-
-    if (!delayEqual(slack, slack_init_)
-        && delayLessEqual(slack, slack_threshold_, this)) {
-      debugPrint(debug_, "wns", 3, "insert %s %s",
-                 vertex->to_string(this).c_str(),
-                 delayAsString(slack, this));
-      queue_->insert(vertex);
-    }
-    else {
-      debugPrint(debug_, "wns", 3, "delete %s %s",
-                 vertex->to_string(this).c_str(),
-                 delayAsString(slack, this));
-      queue_->erase(vertex);
-    }
-    //checkQueue(path_ap_index);
+    debugPrint(debug_, "wns", 3, "update %s %s",
+               vertex->to_string(this).c_str(),
+               delayAsString(slack, this));
+    treeErase(vertex);
+    if (!delayEqual(slack, slack_init_))
+      treeInsert(vertex, slack);
   }
 }
 
 void
-WorstSlack::setWorstSlack(Vertex *vertex,
-			  Slack slack)
+WorstSlack::treeInsert(Vertex *vertex,
+                       Slack slack)
 {
-  debugPrint(debug_, "wns", 3, "%s %s",
-             vertex->to_string(this).c_str(),
-             delayAsString(slack, this));
-  worst_vertex_ = vertex;
-  worst_slack_ = slack;
+  int node;
+  if (free_nodes_.empty()) {
+    node = nodes_.size();
+    nodes_.emplace_back();
+  }
+  else {
+    node = free_nodes_.back();
+    free_nodes_.pop_back();
+  }
+  // xorshift32
+  random_ ^= random_ << 13;
+  random_ ^= random_ >> 17;
+  random_ ^= random_ << 5;
+  nodes_[node] = {slack, vertex, random_, -1, -1, 1};
+  vertex_nodes_[vertex] = node;
+
+  int left, right;
+  treeSplit(root_, slack, vertex, false, left, right);
+  root_ = treeMerge(treeMerge(left, node), right);
 }
 
-////////////////////////////////////////////////////////////////
+void
+WorstSlack::treeErase(Vertex *vertex)
+{
+  auto node_itr = vertex_nodes_.find(vertex);
+  if (node_itr != vertex_nodes_.end()) {
+    int node = node_itr->second;
+    vertex_nodes_.erase(node_itr);
+    Slack slack = nodes_[node].slack;
+    int left, mid, right;
+    treeSplit(root_, slack, vertex, false, left, right);
+    // mid is the node for vertex.
+    treeSplit(right, slack, vertex, true, mid, right);
+    root_ = treeMerge(left, right);
+    free_nodes_.push_back(node);
+  }
+}
 
-WnsSlackLess::WnsSlackLess(PathAPIndex path_ap_index,
-			   const StaState *sta) :
-  path_ap_index_(path_ap_index),
-  search_(sta->search())
+void
+WorstSlack::treeSplit(int node,
+                      Slack slack,
+                      const Vertex *vertex,
+                      bool or_equal,
+                      // Return values.
+                      int &left,
+                      int &right)
+{
+  if (node < 0) {
+    left = -1;
+    right = -1;
+  }
+  else if (nodeLess(node, slack, vertex, or_equal)) {
+    treeSplit(nodes_[node].right, slack, vertex, or_equal,
+              nodes_[node].right, right);
+    left = node;
+    updateSize(node);
+  }
+  else {
+    treeSplit(nodes_[node].left, slack, vertex, or_equal,
+              left, nodes_[node].left);
+    right = node;
+    updateSize(node);
+  }
+}
+
+int
+WorstSlack::treeMerge(int left,
+                      int right)
 {
+  if (left < 0)
+    return right;
+  else if (right < 0)
+    return left;
+  else if (nodes_[left].priority > nodes_[right].priority) {
+    nodes_[left].right = treeMerge(nodes_[left].right, right);
+    updateSize(left);
+    return left;
+  }
+  else {
+    nodes_[right].left = treeMerge(left, nodes_[right].left);
+    updateSize(right);
+    return right;
+  }
 }
 
+void
+WorstSlack::updateSize(int node)
+{
+  SlackTreeNode &tree_node = nodes_[node];
+  tree_node.size = treeSize(tree_node.left) + treeSize(tree_node.right) + 1;
+}
+
+size_t
+WorstSlack::treeSize(int node) const
+{
+  return node < 0 ? 0 : nodes_[node].size;
+}
+
+// Order by slack and then vertex id.
+// Fuzzy slack compares are not transitive so the tree uses exact ones.
 bool
-WnsSlackLess::operator()(Vertex *vertex1,
-			 Vertex *vertex2)
+WorstSlack::nodeLess(int node,
+                     Slack slack,
+                     const Vertex *vertex,
+                     bool or_equal) const
 {
-  return delayLess(search_->wnsSlack(vertex1, path_ap_index_),
-		   search_->wnsSlack(vertex2, path_ap_index_),
-		   search_);
+  const SlackTreeNode &tree_node = nodes_[node];
+  float slack1 = delayAsFloat(tree_node.slack);
+  float slack2 = delayAsFloat(slack);
+  if (slack1 < slack2)
+    return true;
+  else if (slack2 < slack1)
+    return false;
+  else {
+    VertexId id1 = graph_->id(tree_node.vertex);
+    VertexId id2 = graph_->id(vertex);
+    return or_equal ? id1 <= id2 : id1 < id2;
+  }
 }
 
 } // namespace
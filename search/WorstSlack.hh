@@ -24,7 +24,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <mutex>
+#include <vector>
+#include <unordered_map>
 
 #include "MinMax.hh"
 #include "Vector.hh"
@@ -36,7 +39,6 @@ namespace sta {
 
 class StaState;
 class WorstSlack;
-class WnsSlackLess;
 
 typedef Vector<WorstSlack> WorstSlackSeq;
 
@@ -53,6 +55,16 @@ public:
 		  // Return values.
 		  Slack &worst_slack,
 		  Vertex *&worst_vertex);
+  // Endpoints with the worst slacks in increasing slack order.
+  void worstEndpoints(const Corner *corner,
+                      const MinMax *min_max,
+                      size_t count,
+                      // Return value.
+                      VertexSeq &endpoints);
+  // Number of endpoints with slack less than threshold.
+  size_t endpointCount(const Corner *corner,
+                       const MinMax *min_max,
+                       Slack threshold);
   void updateWorstSlacks(Vertex *vertex,
 			 SlackSeq &slacks);
   void worstSlackNotifyBefore(Vertex *vertex);
@@ -62,55 +74,70 @@ protected:
   const StaState *sta_;
 };
 
-class WnsSlackLess
+class SlackTreeNode
 {
 public:
-  WnsSlackLess(PathAPIndex path_ap_index,
-	       const StaState *sta);
-  bool operator()(Vertex *vertex1,
-		  Vertex *vertex2);
-
-private:
-  PathAPIndex path_ap_index_;
-  Search *search_;
+  Slack slack;
+  Vertex *vertex;
+  uint32_t priority;
+  int left;
+  int right;
+  size_t size;
 };
 
+// Endpoint slacks for one path analysis point in an order statistics
+// tree (treap with subtree sizes) so slack updates, worst endpoints and
+// slack counts are O(log endpoints).
 class WorstSlack : public StaState
 {
 public:
   WorstSlack(StaState *sta);
-  ~WorstSlack();
   WorstSlack(const WorstSlack &);
   void worstSlack(PathAPIndex path_ap_index,
 		  // Return values.
 		  Slack &worst_slack,
 		  Vertex *&worst_vertex);
+  void worstEndpoints(PathAPIndex path_ap_index,
+                      size_t count,
+                      // Return value.
+                      VertexSeq &endpoints);
+  size_t endpointCount(PathAPIndex path_ap_index,
+                       Slack threshold);
   void updateWorstSlack(Vertex *vertex,
 			SlackSeq &slacks,
 			PathAPIndex path_ap_index);
   void deleteVertexBefore(Vertex *vertex);
 
 protected:
-  void findWorstSlack(PathAPIndex path_ap_index);
-  void initQueue(PathAPIndex path_ap_index);
-  void findWorstInQueue(PathAPIndex path_ap_index);
-  void setWorstSlack(Vertex *vertex,
-		     Slack slack);
-  void sortQueue(PathAPIndex path_ap_index);
-  void checkQueue(PathAPIndex path_ap_index);
+  void ensureTree(PathAPIndex path_ap_index);
+  void treeInsert(Vertex *vertex,
+                  Slack slack);
+  void treeErase(Vertex *vertex);
+  // Split tree into nodes less than (slack, vertex) and the rest.
+  // With or_equal the node equal to (slack, vertex) goes left.
+  void treeSplit(int node,
+                 Slack slack,
+                 const Vertex *vertex,
+                 bool or_equal,
+                 // Return values.
+                 int &left,
+                 int &right);
+  int treeMerge(int left,
+                int right);
+  void updateSize(int node);
+  size_t treeSize(int node) const;
+  bool nodeLess(int node,
+                Slack slack,
+                const Vertex *vertex,
+                bool or_equal) const;
 
   Slack slack_init_;
-  // Vertex with the worst slack.
-  // When nullptr the worst slack is unknown but in the queue.
-  Vertex *worst_vertex_;
-  Slack worst_slack_;
-  Slack slack_threshold_;
-  // Vertices with slack < threshold_
-  VertexSet *queue_;
-  // Queue is sorted and pruned to min_queue_size_ vertices when it
-  // reaches max_queue_size_.
-  int min_queue_size_;
-  int max_queue_size_;
+  bool tree_exists_;
+  int root_;
+  std::vector<SlackTreeNode> nodes_;
+  std::vector<int> free_nodes_;
+  std::unordered_map<const Vertex*, int> vertex_nodes_;
+  uint32_t random_;
   std::mutex lock_;
 };
 
@@ -0,0 +1,229 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#include "WriteTimingPaths.hh"
+
+#include "Error.hh"
+#include "Network.hh"
+#include "Liberty.hh"
+#include "TimingArc.hh"
+#include "TimingRole.hh"
+#include "Graph.hh"
+#include "GraphDelayCalc.hh"
+#include "PathAnalysisPt.hh"
+#include "PathEnd.hh"
+#include "PathExpanded.hh"
+#include "PathGroup.hh"
+#include "Search.hh"
+
+namespace sta {
+
+TimingPathWriter::TimingPathWriter(const char *filename,
+                                   StaState *sta) :
+  StaState(sta),
+  filename_(filename),
+  stream_(fopen(filename, "wb")),
+  path_count_(0)
+{
+  if (stream_ == nullptr)
+    throw FileNotWritable(filename);
+  writeBytes("STAPATHS", 8);
+  writeBytes(&version_, sizeof(version_));
+}
+
+TimingPathWriter::~TimingPathWriter()
+{
+  if (stream_)
+    fclose(stream_);
+}
+
+void
+TimingPathWriter::finish()
+{
+  writeTag('E');
+  writeBytes(&path_count_, sizeof(path_count_));
+  int error = fclose(stream_);
+  stream_ = nullptr;
+  if (error)
+    throw FileNotWritable(filename_.c_str());
+}
+
+void
+TimingPathWriter::writePathEnds(const PathEndSeq &path_ends)
+{
+  if (!path_ends.empty()) {
+    for (const PathEnd *path_end : path_ends)
+      writePathEnd(path_end);
+
+    writeTag('G');
+    uint32_t path_count = path_groups_.size();
+    uint32_t pin_count = pin_names_.size();
+    writeBytes(&path_count, sizeof(path_count));
+    writeBytes(&pin_count, sizeof(pin_count));
+    writeStrings();
+
+    writeColumn(path_groups_);
+    writeColumn(path_starts_);
+    writeColumn(path_ends_);
+    writeColumn(path_min_maxs_);
+    writeColumn(path_slacks_);
+    writeColumn(path_arrivals_);
+    writeColumn(path_requireds_);
+    writeColumn(path_pin_counts_);
+
+    writeColumn(pin_names_);
+    writeColumn(pin_cells_);
+    writeColumn(pin_roles_);
+    writeColumn(pin_rfs_);
+    writeColumn(pin_arrivals_);
+    writeColumn(pin_incrs_);
+    writeColumn(pin_slews_);
+    writeColumn(pin_caps_);
+
+    path_count_ += path_count;
+    clearColumns();
+  }
+}
+
+void
+TimingPathWriter::writePathEnd(const PathEnd *path_end)
+{
+  PathExpanded expanded(path_end->path(), this);
+  const Pin *startpoint = expanded.startPath()->vertex(this)->pin();
+  const Pin *endpoint = expanded.endPath()->vertex(this)->pin();
+  const PathGroup *group = search_->pathGroup(path_end);
+  path_groups_.push_back(group ? stringIndex(group->name()) : null_index_);
+  path_starts_.push_back(stringIndex(sdc_network_->pathName(startpoint)));
+  path_ends_.push_back(stringIndex(sdc_network_->pathName(endpoint)));
+  path_min_maxs_.push_back(path_end->minMax(this) == MinMax::max() ? 1 : 0);
+  if (path_end->isUnconstrained()) {
+    path_slacks_.push_back(0.0);
+    path_requireds_.push_back(0.0);
+  }
+  else {
+    path_slacks_.push_back(delayAsFloat(path_end->slack(this)));
+    path_requireds_.push_back(delayAsFloat(path_end->requiredTimeOffset(this)));
+  }
+  path_arrivals_.push_back(delayAsFloat(path_end->dataArrivalTimeOffset(this)));
+  path_pin_counts_.push_back(expanded.size());
+
+  float prev_arrival = 0.0;
+  for (size_t i = 0; i < expanded.size(); i++) {
+    const Path *path = expanded.path(i);
+    const Pin *pin = path->vertex(this)->pin();
+    const Instance *inst = network_->instance(pin);
+    const Cell *cell = inst ? network_->cell(inst) : nullptr;
+    const TimingArc *prev_arc = path->prevArc(this);
+    const RiseFall *rf = path->transition(this);
+    float arrival = delayAsFloat(path->arrival());
+    float cap = 0.0;
+    if (network_->isDriver(pin)) {
+      DcalcAnalysisPt *dcalc_ap = path->pathAnalysisPt(this)->dcalcAnalysisPt();
+      cap = graph_delay_calc_->loadCap(pin, rf, dcalc_ap);
+    }
+    pin_names_.push_back(stringIndex(sdc_network_->pathName(pin)));
+    pin_cells_.push_back(cell ? stringIndex(network_->name(cell)) : null_index_);
+    pin_roles_.push_back(prev_arc
+                         ? stringIndex(prev_arc->role()->to_string().c_str())
+                         : null_index_);
+    pin_rfs_.push_back(rf->index());
+    pin_arrivals_.push_back(arrival);
+    pin_incrs_.push_back(i == 0 ? 0.0 : arrival - prev_arrival);
+    pin_slews_.push_back(delayAsFloat(path->slew(this)));
+    pin_caps_.push_back(cap);
+    prev_arrival = arrival;
+  }
+}
+
+uint32_t
+TimingPathWriter::stringIndex(const char *str)
+{
+  auto itr = string_indices_.find(str);
+  if (itr == string_indices_.end()) {
+    uint32_t index = string_indices_.size();
+    string_indices_[str] = index;
+    strings_.push_back(str);
+    return index;
+  }
+  else
+    return itr->second;
+}
+
+void
+TimingPathWriter::writeStrings()
+{
+  uint32_t string_count = strings_.size();
+  writeBytes(&string_count, sizeof(string_count));
+  for (const std::string &str : strings_) {
+    uint32_t length = str.size();
+    writeBytes(&length, sizeof(length));
+    writeBytes(str.c_str(), length);
+  }
+  strings_.clear();
+}
+
+template <class COLUMN>
+void
+TimingPathWriter::writeColumn(const std::vector<COLUMN> &column)
+{
+  writeBytes(column.data(), sizeof(COLUMN) * column.size());
+}
+
+void
+TimingPathWriter::writeTag(char tag)
+{
+  writeBytes(&tag, sizeof(tag));
+}
+
+void
+TimingPathWriter::writeBytes(const void *bytes,
+                             size_t size)
+{
+  if (fwrite(bytes, 1, size, stream_) != size)
+    throw FileNotWritable(filename_.c_str());
+}
+
+void
+TimingPathWriter::clearColumns()
+{
+  path_groups_.clear();
+  path_starts_.clear();
+  path_ends_.clear();
+  path_min_maxs_.clear();
+  path_slacks_.clear();
+  path_arrivals_.clear();
+  path_requireds_.clear();
+  path_pin_counts_.clear();
+
+  pin_names_.clear();
+  pin_cells_.clear();
+  pin_roles_.clear();
+  pin_rfs_.clear();
+  pin_arrivals_.clear();
+  pin_incrs_.clear();
+  pin_slews_.clear();
+  pin_caps_.clear();
+}
+
+} // namespace
@@ -0,0 +1,107 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "StaState.hh"
+#include "SearchClass.hh"
+
+namespace sta {
+
+// Columnar binary timing path file.
+// Values are in host byte order (little endian on supported hosts),
+// times in seconds and capacitances in farads.
+//
+//  header     "STAPATHS" u32 version
+//  row group  'G' u32 path_count u32 pin_count
+//             u32 string_count {u32 length, chars}  names added to dictionary
+//             path columns, path_count values each
+//               u32 group, u32 startpoint, u32 endpoint (dictionary indices)
+//               u8 min_max (0 min, 1 max)
+//               f32 slack, f32 arrival, f32 required
+//               u32 pin_count (pins in the path)
+//             pin columns, pin_count values each
+//               u32 pin, u32 cell, u32 arc role (dictionary, ~0 for none)
+//               u8 rise_fall (0 rise, 1 fall)
+//               f32 arrival, f32 incr, f32 slew, f32 capacitance (0 for loads)
+//  trailer    'E' u64 path_count
+class TimingPathWriter : public StaState
+{
+public:
+  // Throws FileNotWritable, as do writePathEnds and finish when a
+  // write fails.
+  TimingPathWriter(const char *filename,
+                   StaState *sta);
+  ~TimingPathWriter();
+  // Write path ends as one row group.
+  void writePathEnds(const PathEndSeq &path_ends);
+  void finish();
+
+protected:
+  void writePathEnd(const PathEnd *path_end);
+  uint32_t stringIndex(const char *str);
+  void writeStrings();
+  template <class COLUMN>
+  void writeColumn(const std::vector<COLUMN> &column);
+  void clearColumns();
+  void writeTag(char tag);
+  void writeBytes(const void *bytes,
+                  size_t size);
+
+  std::string filename_;
+  FILE *stream_;
+  uint64_t path_count_;
+  std::unordered_map<std::string, uint32_t> string_indices_;
+  // Dictionary strings added since the last row group.
+  std::vector<std::string> strings_;
+
+  std::vector<uint32_t> path_groups_;
+  std::vector<uint32_t> path_starts_;
+  std::vector<uint32_t> path_ends_;
+  std::vector<uint8_t> path_min_maxs_;
+  std::vector<float> path_slacks_;
+  std::vector<float> path_arrivals_;
+  std::vector<float> path_requireds_;
+  std::vector<uint32_t> path_pin_counts_;
+
+  std::vector<uint32_t> pin_names_;
+  std::vector<uint32_t> pin_cells_;
+  std::vector<uint32_t> pin_roles_;
+  std::vector<uint8_t> pin_rfs_;
+  std::vector<float> pin_arrivals_;
+  std::vector<float> pin_incrs_;
+  std::vector<float> pin_slews_;
+  std::vector<float> pin_caps_;
+
+  static constexpr uint32_t null_index_ = ~0U;
+  static constexpr uint32_t version_ = 1;
+};
+
+} // namespace
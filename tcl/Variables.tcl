@@ -144,6 +144,14 @@ proc trace_input_port_default_clock { name1 name2 op } {
     use_default_arrival_clock set_use_default_arrival_clock
 }
 
+trace variable ::sta_tag_compression "rw" \
+  sta::trace_tag_compression
+
+proc trace_tag_compression { name1 name2 op } {
+  trace_boolean_var $op ::sta_tag_compression \
+    tag_compression set_tag_compression
+}
+
 trace variable ::sta_propagate_all_clocks "rw" \
   sta::trace_propagate_all_clocks
 
@@ -0,0 +1,31 @@
+# write_activity_db/read_activity_db restore the vcd activities
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+
+proc read_constraints {} {
+  read_sdc ../examples/gcd_sky130hd.sdc
+  read_spef ../examples/gcd_sky130hd.spef
+}
+
+proc report_activities {} {
+  with_output_to_variable activities {
+    report_activity_annotation
+    report_power
+    report_power -interval
+  }
+  return $activities
+}
+
+read_constraints
+read_vcd -scope gcd_tb/gcd1 -interval 30 ../examples/gcd_sky130hd.vcd.gz
+set vcd_activities [report_activities]
+set filename [file join results activity_db.db]
+write_activity_db $filename
+
+sta::clear_sta
+read_constraints
+read_activity_db $filename
+set db_activities [report_activities]
+puts "activities match [expr { $db_activities == $vcd_activities }]"
+puts "not db [catch { read_activity_db ../examples/gcd_sky130hd.sdc }]"
@@ -0,0 +1,51 @@
+# incremental delay calc reuses saved arc results only when valid
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+sta::set_thread_count 1
+
+proc report_paths {} {
+  with_output_to_variable paths {
+    report_checks -through _291_/Y -fields {slew cap} -digits 4
+  }
+  return $paths
+}
+
+# Count the _291_/Y arcs that reuse saved results while updating timing.
+proc reuse_count {} {
+  sta::set_debug delay_calc 3
+  with_output_to_variable log { report_checks -through _291_/Y }
+  sta::set_debug delay_calc 0
+  set vertex ""
+  set count 0
+  foreach line [split $log "\n"] {
+    regexp {^find delays (\S+)} $line ignore vertex
+    if { $vertex == "_291_/Y" && [string match "*reuse previous arc delay*" $line] } {
+      incr count
+    }
+  }
+  return $count
+}
+
+# Compare the incremental delays with delays found from scratch.
+proc check_delays { what reused } {
+  set paths [report_paths]
+  sta::delays_invalid
+  set full_paths [report_paths]
+  puts "$what reused [expr { $reused > 0 }] match [expr { $paths == $full_paths }]"
+}
+
+report_paths
+# _291_ is a nand2 with req_msg[0] on B. The first incremental update
+# saves its arc results and the second reuses the A arcs.
+set_input_transition 0.2 [get_ports {req_msg[0]}]
+reuse_count
+set_input_transition 0.3 [get_ports {req_msg[0]}]
+check_delays input_slew [reuse_count]
+# A load change invalidates the saved _291_ results.
+set_input_transition 0.2 [get_ports {req_msg[0]}]
+reuse_count
+set_load 0.02 [get_nets _109_]
+check_delays load [reuse_count]
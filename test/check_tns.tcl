@@ -0,0 +1,25 @@
+# check_total_negative_slacks after incremental updates
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_spef ../examples/gcd_sky130hd.spef
+create_clock -period 0.5 [get_ports clk]
+set_input_delay 0.1 -clock clk [all_inputs -no_clocks]
+set_output_delay 0.1 -clock clk [all_outputs]
+
+proc check_tns { what } {
+  set tns [sta::total_negative_slack_cmd max]
+  puts "$what negative [expr { $tns < 0.0 }] consistent [sta::check_total_negative_slacks]"
+}
+
+check_tns initial
+set_input_delay 1.5 -clock clk [get_ports {req_msg[*]}]
+check_tns input_delay
+set_output_delay 1.0 -clock clk [get_ports {resp_msg[*]}]
+check_tns output_delay
+set_load 0.05 [get_nets {resp_msg[0]}]
+check_tns load
+replace_cell _411_ sky130_fd_sc_hd__dfxtp_1
+check_tns replace_cell
+set_input_delay 0.4 -clock clk [get_ports {req_msg[*]}]
+check_tns input_delay_restore
@@ -0,0 +1,42 @@
+# CRPR common clock path cache reuse and invalidation after clock edits
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+set_propagated_clock [all_clocks]
+set_operating_conditions -analysis_type on_chip_variation
+set_timing_derate -early 0.9
+set_timing_derate -late 1.1
+# The common path cache is per thread.
+sta::set_thread_count 1
+
+proc report_paths {} {
+  with_output_to_variable paths {
+    report_checks -path_delay min_max -group_path_count 100 -format end
+  }
+  return $paths
+}
+
+# Compare the incremental report to one from scratch.
+proc check_cache { what prev_paths } {
+  sta::reset_crpr_common_path_stats
+  set paths [report_paths]
+  with_output_to_variable stats { sta::report_crpr_common_path_stats }
+  regexp {hits ([0-9]+) misses ([0-9]+)} $stats ignore hits misses
+  sta::arrivals_invalid
+  set full_paths [report_paths]
+  puts "$what hits [expr { $hits > 0 }] misses [expr { $misses > 0 }] match [expr { $paths == $full_paths }] changed [expr { $paths != $prev_paths }]"
+  return $paths
+}
+
+set paths [check_cache initial {}]
+# Reports without edits reuse the cached common paths.
+sta::reset_crpr_common_path_stats
+set paths1 [report_paths]
+with_output_to_variable stats { sta::report_crpr_common_path_stats }
+puts "cached [regexp {hits [1-9][0-9]* misses 0$} [string trim $stats]] match [expr { $paths1 == $paths }]"
+replace_cell clkbuf_2_0__f_clk sky130_fd_sc_hd__clkbuf_8
+set paths [check_cache resize $paths]
+set_clock_latency -source -early 0.0 -late 0.05 [get_clocks clk]
+set paths [check_cache latency $paths]
@@ -0,0 +1,24 @@
+# report_dmp_ceff_stats sums the counts of the per-thread delay calculators
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+
+proc dmp_stats { thread_count } {
+  sta::set_thread_count $thread_count
+  sta::reset_dmp_ceff_stats
+  sta::delays_invalid
+  sta::find_delays
+  with_output_to_variable stats { sta::report_dmp_ceff_stats }
+  regexp {solves ([0-9]+) iterations ([0-9]+)} $stats ignore solves iterations
+  return [list $solves $iterations]
+}
+
+set serial [dmp_stats 1]
+set threaded [dmp_stats 4]
+puts "solves [expr { [lindex $serial 0] > 0 }] iterations [expr { [lindex $serial 1] > 0 }]"
+puts "threads match [expr { $serial == $threaded }]"
+sta::reset_dmp_ceff_stats
+with_output_to_variable stats { sta::report_dmp_ceff_stats }
+puts "reset [regexp {solves 0 iterations 0 } $stats]"
@@ -0,0 +1,20 @@
+# report_endpoint_slack_histogram bin counts
+read_liberty asap7_small.lib.gz
+read_verilog reg1_asap7.v
+link_design top
+create_clock -name clk -period 500 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 [all_inputs -no_clocks]
+set_output_delay -clock clk 0 [all_outputs]
+
+report_endpoint_slack_histogram
+report_endpoint_slack_histogram -slack_min -2000 -slack_max 1000 -bins 3
+set_input_delay -clock clk 1000 [get_ports in1]
+report_endpoint_slack_histogram -slack_min -2000 -slack_max 1000 -bins 3
+set_output_delay -clock clk 2000 [get_ports out]
+report_endpoint_slack_histogram -slack_min -2000 -slack_max 1000 -bins 3
+# out is below -slack_min.
+report_endpoint_slack_histogram -slack_min -1000 -slack_max 0 -bins 1
+# The default bins end at zero slack.
+with_output_to_variable report { report_endpoint_slack_histogram -bins 1 }
+puts "default [lrange $report 1 2]"
+puts "range error [catch { report_endpoint_slack_histogram -slack_min 0 -slack_max -1 }]"
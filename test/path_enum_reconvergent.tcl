@@ -0,0 +1,51 @@
+# path enumeration with group/endpoint path counts on reconvergent paths
+read_liberty asap7_small.lib.gz
+read_verilog path_enum_reconvergent.v
+link_design top
+create_clock -name clk -period 1000 clk
+set_input_delay -clock clk 0 in1
+set_output_delay -clock clk 0 out
+
+proc path_keys { args } {
+  set keys {}
+  foreach path_end [find_timing_paths {*}$args] {
+    set key [list [get_full_name [get_property $path_end endpoint]] \
+               [get_property $path_end slack]]
+    foreach point [get_property $path_end points] {
+      lappend key [get_full_name [get_property $point pin]] \
+        [get_property $point arrival]
+    }
+    lappend keys $key
+  }
+  return $keys
+}
+
+# All paths. There are 2^stages paths to each endpoint for each
+# clock to q transition.
+set all_paths [path_keys -group_path_count 1000 -endpoint_path_count 1000]
+puts "all paths [llength $all_paths]"
+
+# The worst endpoint_count paths to each endpoint, then the worst
+# group_count of those.
+proc filter_paths { paths group_count endpoint_count } {
+  set filtered {}
+  foreach path $paths {
+    set endpoint [lindex $path 0]
+    if { ![info exists counts($endpoint)] } {
+      set counts($endpoint) 0
+    }
+    if { $counts($endpoint) < $endpoint_count
+         && [llength $filtered] < $group_count } {
+      lappend filtered $path
+      incr counts($endpoint)
+    }
+  }
+  return $filtered
+}
+
+foreach {group_count endpoint_count} {1 1 5 1 5 3 10 4 20 2 20 6 7 40 40 7 57 32} {
+  set paths [path_keys -group_path_count $group_count \
+               -endpoint_path_count $endpoint_count]
+  set expected [filter_paths $all_paths $group_count $endpoint_count]
+  puts "$group_count $endpoint_count match [expr { $paths == $expected }] [llength $paths]"
+}
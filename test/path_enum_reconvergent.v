@@ -0,0 +1,28 @@
+module top (in1, clk, out);
+  input in1, clk;
+  output out;
+  wire q1, c1_1, s1, c2_1, c2_2, s2, c3_1, c3_2, c3_3, c3_4, c4_1, c4_2, c4_3, c4_4, c4_5, c4_6, c4_7, c4_8, s4;
+
+  DFFHQx4_ASAP7_75t_R r1 (.D(in1), .CLK(clk), .Q(q1));
+  BUFx2_ASAP7_75t_R b1_1 (.A(q1), .Y(c1_1));
+  AND2x2_ASAP7_75t_R a1 (.A(q1), .B(c1_1), .Y(s1));
+  BUFx2_ASAP7_75t_R b2_1 (.A(s1), .Y(c2_1));
+  BUFx2_ASAP7_75t_R b2_2 (.A(c2_1), .Y(c2_2));
+  AND2x2_ASAP7_75t_R a2 (.A(s1), .B(c2_2), .Y(s2));
+  BUFx2_ASAP7_75t_R b3_1 (.A(s2), .Y(c3_1));
+  BUFx2_ASAP7_75t_R b3_2 (.A(c3_1), .Y(c3_2));
+  BUFx2_ASAP7_75t_R b3_3 (.A(c3_2), .Y(c3_3));
+  BUFx2_ASAP7_75t_R b3_4 (.A(c3_3), .Y(c3_4));
+  AND2x2_ASAP7_75t_R a3 (.A(s2), .B(c3_4), .Y(out));
+  BUFx2_ASAP7_75t_R b4_1 (.A(out), .Y(c4_1));
+  BUFx2_ASAP7_75t_R b4_2 (.A(c4_1), .Y(c4_2));
+  BUFx2_ASAP7_75t_R b4_3 (.A(c4_2), .Y(c4_3));
+  BUFx2_ASAP7_75t_R b4_4 (.A(c4_3), .Y(c4_4));
+  BUFx2_ASAP7_75t_R b4_5 (.A(c4_4), .Y(c4_5));
+  BUFx2_ASAP7_75t_R b4_6 (.A(c4_5), .Y(c4_6));
+  BUFx2_ASAP7_75t_R b4_7 (.A(c4_6), .Y(c4_7));
+  BUFx2_ASAP7_75t_R b4_8 (.A(c4_7), .Y(c4_8));
+  AND2x2_ASAP7_75t_R a4 (.A(out), .B(c4_8), .Y(s4));
+  DFFHQx4_ASAP7_75t_R r2 (.D(s2), .CLK(clk), .Q());
+  DFFHQx4_ASAP7_75t_R r3 (.D(s4), .CLK(clk), .Q());
+endmodule // top
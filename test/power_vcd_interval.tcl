@@ -0,0 +1,63 @@
+# read_vcd -interval and report_power -interval
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+
+proc power_match { power1 power2 } {
+  return [expr abs($power1 - $power2) <= 1e-4 * abs($power2)]
+}
+
+puts "no intervals [catch { report_power -interval }]"
+# The vcd file is 125ns long.
+read_vcd -scope gcd_tb/gcd1 -interval 30 ../examples/gcd_sky130hd.vcd.gz
+set powers [sta::interval_power [sta::cmd_corner]]
+set interval_count [expr [llength $powers] / 4]
+set positive 1
+foreach {internal switching leakage total} $powers {
+  if { !($total > 0.0 && $total >= $leakage) } {
+    set positive 0
+  }
+}
+puts "intervals $interval_count positive $positive"
+
+# The last interval ends at the end of the vcd.
+set ends {}
+foreach end [sta::power_interval_ends] {
+  lappend ends [sta::format_time $end 1]
+}
+puts "ends $ends"
+
+# Switching power is linear in the densities so the time weighted
+# interval switching power is the average switching power.
+set start 0.0
+set switching_sum 0.0
+set leakages {}
+foreach {internal switching leakage total} $powers end [sta::power_interval_ends] {
+  set switching_sum [expr $switching_sum + $switching * ($end - $start)]
+  lappend leakages $leakage
+  set start $end
+}
+set design_switching [lindex [sta::design_power [sta::cmd_corner]] 1]
+puts "switching average [power_match [expr $switching_sum / $start] $design_switching]"
+# Conditional leakage follows the interval duties.
+puts "leakage varies [expr [llength [lsort -unique -real $leakages]] > 1]"
+
+with_output_to_variable report { report_power -interval }
+set report_ends {}
+foreach line [split $report "\n"] {
+  if { [regexp {^ *[0-9.]+ +([0-9.]+) } $line ignore end] } {
+    lappend report_ends $end
+  }
+}
+puts "report ends $report_ends"
+
+# One interval covering the whole vcd matches the average power.
+read_vcd -scope gcd_tb/gcd1 -interval 1000 ../examples/gcd_sky130hd.vcd.gz
+lassign [sta::interval_power [sta::cmd_corner]] \
+  internal switching leakage total
+lassign [sta::design_power [sta::cmd_corner]] \
+  design_internal design_switching design_leakage design_total
+puts "one interval [llength [sta::power_interval_ends]] [sta::format_time [lindex [sta::power_interval_ends] 0] 1]"
+puts "internal [power_match $internal $design_internal] switching [power_match $switching $design_switching] leakage [power_match $leakage $design_leakage] total [power_match $total $design_total]"
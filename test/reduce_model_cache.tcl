@@ -0,0 +1,31 @@
+# reduced models are only shared between reductions of the same network
+read_liberty asap7_invbuf.lib.gz
+read_verilog reduce_model_cache.v
+link_design top
+create_clock -name clk -period 500
+set_input_delay -clock clk 1 {in1 in2 in3}
+set_input_transition 10 {in1 in2 in3}
+sta::set_thread_count 1
+
+# Count the reductions that reuse a cached model while finding delays.
+proc reuse_count {} {
+  sta::set_debug parasitic_reduce 2
+  with_output_to_variable log { report_checks -unconstrained -to out1 }
+  sta::set_debug parasitic_reduce 0
+  return [regexp -all {reuse reduced model} $log]
+}
+
+foreach calc {dmp_ceff_elmore dmp_ceff_two_pole} {
+  set_delay_calculator $calc
+  # out2 is within the value rounding the cache used to apply to out1.
+  # out3 is a copy of out1.
+  read_spef reduce_model_cache.spef
+  # Rise and fall reductions of each net share a model.
+  set reused [reuse_count]
+  foreach out {out1 out2 out3} {
+    set arrival($out) [get_property [get_ports $out] arrival_max_rise]
+  }
+  puts "$calc reused [expr { $reused > 0 }]"
+  puts "out1 out3 match [expr { $arrival(out1) == $arrival(out3) }]"
+  puts "out1 out2 differ [expr { $arrival(out1) != $arrival(out2) }]"
+}
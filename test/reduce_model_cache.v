@@ -0,0 +1,8 @@
+module top (in1, in2, in3, out1, out2, out3);
+  input in1, in2, in3;
+  output out1, out2, out3;
+
+  BUFx2_ASAP7_75t_R u1 (.A(in1), .Y(out1));
+  BUFx2_ASAP7_75t_R u2 (.A(in2), .Y(out2));
+  BUFx2_ASAP7_75t_R u3 (.A(in3), .Y(out3));
+endmodule // top
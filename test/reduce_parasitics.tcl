@@ -0,0 +1,25 @@
+# reduce_parasitics on threads matches reducing during delay calculation
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+
+proc report_paths { reduce_args thread_count } {
+  sta::set_thread_count $thread_count
+  read_spef ../examples/gcd_sky130hd.spef
+  if { $reduce_args != "none" } {
+    reduce_parasitics {*}$reduce_args
+  }
+  with_output_to_variable paths {
+    report_checks -path_delay min_max -group_path_count 20 -fields {slew cap}
+  }
+  return $paths
+}
+
+foreach calc {dmp_ceff_elmore dmp_ceff_two_pole} {
+  set_delay_calculator $calc
+  set serial [report_paths none 1]
+  set reduced [report_paths {} 4]
+  set reduced_max [report_paths -max 4]
+  puts "$calc match [expr { $reduced == $serial }] [expr { $reduced_max == $serial }]"
+}
@@ -138,6 +138,12 @@ record_example_tests {
 }
 
 record_sta_tests {
+  activity_db
+  arc_dcalc_reuse
+  check_tns
+  crpr_cache
+  dmp_ceff_stats
+  endpoint_slack_histogram
   get_filter
   get_is_memory
   get_lib_pins_of_objects
@@ -149,13 +155,25 @@ record_sta_tests {
   liberty_ccsn
   liberty_float_as_str
   liberty_latch3
+  path_enum_reconvergent
   path_group_names
+  power_vcd_interval
   prima3
+  reduce_model_cache
+  reduce_parasitics
+  required_tolerance
   report_checks_src_attr
+  report_checks_stream
   report_json1
   report_json2
+  report_threads
   suppress_msg
+  tag_compression
   verilog_attribute
+  what_if
+  what_if_spef
+  worst_endpoints
+  write_timing_paths
 }
 
 define_test_group fast [group_tests all]
@@ -0,0 +1,19 @@
+# report_checks -stream reports the same paths as report_checks
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+
+proc compare_stream { args } {
+  with_output_to_variable paths [concat report_checks $args]
+  with_output_to_variable stream [concat report_checks -stream $args]
+  puts "$args match [expr { $paths == $stream }] paths [string match -nocase "*slack*" $paths]"
+}
+
+compare_stream -format end -group_path_count 10
+compare_stream -format end -group_path_count 5 -endpoint_path_count 3
+compare_stream -format end -path_delay min -group_path_count 10
+compare_stream -format end -group_path_count 5 -endpoint_path_count 3 -unique_paths_to_endpoint
+compare_stream -group_path_count 3 -endpoint_path_count 2 -fields {slew cap}
+compare_stream -to _411_/D -group_path_count 4 -endpoint_path_count 4
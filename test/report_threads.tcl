@@ -0,0 +1,47 @@
+# reports with multiple threads match single thread reports
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+
+proc report_with_threads { cmd thread_count } {
+  sta::set_thread_count $thread_count
+  sta::delays_invalid
+  with_output_to_variable report $cmd
+  return $report
+}
+
+proc compare_threads { cmd } {
+  set serial [report_with_threads $cmd 1]
+  set threaded [report_with_threads $cmd 4]
+  puts "$cmd match [expr { $serial == $threaded }] lines [expr { [llength [split $serial "\n"]] > 1 }]"
+}
+
+compare_threads {report_checks -group_path_count 20 -endpoint_path_count 3}
+compare_threads {report_checks -path_delay min -group_path_count 20 -format full_clock_expanded}
+compare_threads {report_checks -group_path_count 10 -format json}
+compare_threads {report_checks -stream -group_path_count 20 -format end}
+compare_threads {report_check_types -verbose -min_pulse_width -max_delay -min_delay}
+compare_threads {report_clock_skew -setup}
+compare_threads {report_clock_skew -hold}
+compare_threads {report_clock_latency}
+compare_threads {report_wns; report_tns; report_worst_slack -max}
+
+# report_clock_min_period prints with puts so compare the periods directly.
+set clk [get_clocks clk]
+sta::set_thread_count 1
+sta::delays_invalid
+set serial_period [sta::find_clk_min_period $clk 1]
+sta::set_thread_count 4
+sta::delays_invalid
+set threaded_period [sta::find_clk_min_period $clk 1]
+puts "min period match [expr { $serial_period == $threaded_period }]"
+
+# Report threads find load caps with their own delay calculator copies.
+set_delay_calculator arnoldi
+puts "delay calculator arnoldi"
+compare_threads {report_checks -group_path_count 10 -format json}
+compare_threads {report_checks -group_path_count 20 -fields {cap slew}}
+set_delay_calculator dmp_ceff_elmore
+sta::set_thread_count 1
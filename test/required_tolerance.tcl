@@ -0,0 +1,22 @@
+# incremental required time tolerance bounds the error in fanin slacks
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+# Make the resp_msg[14] output check set the required times in its fanin.
+set delay 4.0
+set_output_delay $delay -clock clk [get_ports {resp_msg[14]}]
+get_property [get_pins _269_/A] slack_max
+sta::set_search_incremental_tolerance 4.5e-12
+
+# Repeated 1ps output delay changes are each within the tolerance.
+for { set i 1 } { $i <= 9 } { incr i } {
+  set_output_delay [expr { $delay + $i * 0.001 }] -clock clk \
+    [get_ports {resp_msg[14]}]
+  set slack [get_property [get_pins _269_/A] slack_max]
+}
+sta::arrivals_invalid
+set full_slack [get_property [get_pins _269_/A] slack_max]
+set error [expr { abs($slack - $full_slack) }]
+puts "bounded [expr { $error <= 0.0045 }] stale [expr { $error > 0.0001 }]"
@@ -0,0 +1,29 @@
+# sta_tag_compression reports the same paths with fewer tags
+read_liberty asap7_small.lib.gz
+read_verilog reg1_asap7.v
+link_design top
+create_clock -name clk -period 500 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 [all_inputs -no_clocks]
+set_output_delay -clock clk 0 [all_outputs]
+# u1 is not in the fanin of out so the -through u1/Y states are
+# only needed without compression.
+set_false_path -from [get_pins r2/CLK] -through [get_pins u1/Y] -to [get_ports out]
+set_multicycle_path 2 -from [get_pins r1/CLK] -to [get_pins r3/D]
+
+proc report_paths {} {
+  with_output_to_variable paths {
+    report_checks -path_delay min_max -group_path_count 1000
+  }
+  return $paths
+}
+
+set paths1 [report_paths]
+set tags1 [sta::tag_count]
+set sta_tag_compression 1
+set paths2 [report_paths]
+set tags2 [sta::tag_count]
+puts "compression $sta_tag_compression"
+puts "paths match [expr {$paths1 == $paths2}] empty [expr {$paths2 == {}}]"
+puts "tags reduced [expr {$tags2 < $tags1}]"
+with_output_to_variable profile { report_tag_profile -max_count 3 }
+puts "profile [regexp {^[0-9]+ tags, [0-9]+ with exception states} $profile]"
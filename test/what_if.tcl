@@ -0,0 +1,37 @@
+# begin_what_if/rollback_what_if/commit_what_if
+read_liberty asap7_small.lib.gz
+read_verilog reg1_asap7.v
+link_design top
+create_clock -name clk -period 500 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 [all_inputs -no_clocks]
+set_output_delay -clock clk 0 [all_outputs]
+
+proc insert_buffer {} {
+  make_instance b1 BUFx2_ASAP7_75t_R
+  make_net n1
+  disconnect_pin u1z u2/B
+  connect_pin u1z b1/A
+  connect_pin n1 b1/Y
+  connect_pin n1 u2/B
+}
+
+with_output_to_variable orig { report_checks -through u2/B }
+
+begin_what_if
+insert_buffer
+with_output_to_variable edited { report_checks -through u2/B }
+puts "edited [expr { $edited != $orig }]"
+rollback_what_if
+with_output_to_variable rolled_back { report_checks -through u2/B }
+puts "rollback [expr { $rolled_back == $orig }] [llength [get_cells -quiet b1]] [llength [get_nets -quiet n1]]"
+
+begin_what_if
+insert_buffer
+commit_what_if
+with_output_to_variable committed { report_checks -through u2/B }
+puts "commit [expr { $committed == $edited }] [llength [get_cells -quiet b1]]"
+
+puts "no journal [catch { rollback_what_if }] [catch { commit_what_if }]"
+begin_what_if
+puts "nested [catch { begin_what_if }]"
+rollback_what_if
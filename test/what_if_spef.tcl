@@ -0,0 +1,55 @@
+# rollback_what_if restores spef parasitics
+read_liberty asap7_small.lib.gz
+read_verilog reg1_asap7.v
+link_design top
+create_clock -name clk -period 500 {clk1 clk2 clk3}
+set_input_delay -clock clk 1 {in1 in2}
+set_input_transition 10 {in1 in2 clk1 clk2 clk3}
+set_propagated_clock {clk1 clk2 clk3}
+read_spef reg1_asap7.spef
+
+proc report_u2 {} {
+  report_checks -through u2/B -fields {cap slew input_pins}
+  report_parasitic_annotation
+}
+
+proc insert_buffer {} {
+  make_instance b1 BUFx2_ASAP7_75t_R
+  make_net n1
+  disconnect_pin u1z u2/B
+  connect_pin u1z b1/A
+  connect_pin n1 b1/Y
+  connect_pin n1 u2/B
+}
+
+proc remove_buffer {} {
+  delete_instance u1
+  delete_net u1z
+  connect_pin r2q u2/B
+}
+
+with_output_to_variable orig { report_u2 }
+
+begin_what_if
+insert_buffer
+with_output_to_variable edited { report_u2 }
+rollback_what_if
+with_output_to_variable rolled_back { report_u2 }
+puts "insert_buffer [expr { $edited != $orig }] [expr { $rolled_back == $orig }]"
+
+begin_what_if
+remove_buffer
+with_output_to_variable edited { report_u2 }
+rollback_what_if
+with_output_to_variable rolled_back { report_u2 }
+puts "remove_buffer [expr { $edited != $orig }] [expr { $rolled_back == $orig }] [llength [get_cells -quiet u1]] [llength [get_nets -quiet u1z]]"
+
+# Delete an instance and net made by the same what-if.
+begin_what_if
+insert_buffer
+delete_instance b1
+delete_net n1
+connect_pin u1z u2/B
+rollback_what_if
+with_output_to_variable rolled_back { report_u2 }
+puts "made and deleted [expr { $rolled_back == $orig }] [llength [get_cells -quiet b1]] [llength [get_nets -quiet n1]]"
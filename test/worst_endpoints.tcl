@@ -0,0 +1,40 @@
+# worst_endpoints/endpoint_slack_count with incremental updates
+read_liberty asap7_small.lib.gz
+read_verilog reg1_asap7.v
+link_design top
+create_clock -name clk -period 500 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 [all_inputs -no_clocks]
+set_output_delay -clock clk 0 [all_outputs]
+
+proc report_endpoints {} {
+  set endpoints [sta::worst_endpoints 10]
+  set sorted 1
+  set prev_slack ""
+  foreach pin $endpoints {
+    set slack [get_property $pin slack_max]
+    if { $prev_slack != "" && $slack < $prev_slack } {
+      set sorted 0
+    }
+    set prev_slack $slack
+  }
+  set negative [sta::endpoint_slack_count 0]
+  puts "endpoints [llength $endpoints] sorted $sorted"
+  puts "count all [sta::endpoint_slack_count 1e6] none [sta::endpoint_slack_count -1e6] negative $negative"
+  set names {}
+  foreach pin [lrange $endpoints 0 [expr { $negative - 1 }]] {
+    lappend names [get_full_name $pin]
+  }
+  puts [concat "negative endpoints" $names]
+}
+
+report_endpoints
+set_input_delay -clock clk 1000 [get_ports in1]
+report_endpoints
+set_input_delay -clock clk 0 [get_ports in1]
+set_input_delay -clock clk 1000 [get_ports in2]
+report_endpoints
+set_output_delay -clock clk 2000 [get_ports out]
+report_endpoints
+set_output_delay -clock clk 0 [get_ports out]
+set_input_delay -clock clk 0 [get_ports in2]
+report_endpoints
@@ -0,0 +1,93 @@
+# write_timing_paths columnar file contents and errors
+read_liberty asap7_invbuf.lib.gz
+read_liberty asap7_seq.lib.gz
+read_liberty asap7_simple.lib.gz
+read_verilog reg1_asap7.v
+link_design top
+create_clock -name clk -period 500 {clk1 clk2 clk3}
+set_input_delay -clock clk 1 {in1 in2}
+set_input_transition 10 {in1 in2 clk1 clk2 clk3}
+set_propagated_clock {clk1 clk2 clk3}
+read_spef reg1_asap7.spef
+sta::set_delay_calculator prima
+
+proc read_paths_file { filename } {
+  set stream [open $filename r]
+  fconfigure $stream -translation binary
+  set data [read $stream]
+  close $stream
+  set header [string range $data 0 7]
+  set trailer [string index $data end-8]
+  binary scan [string range $data end-7 end] w path_count
+  return [list $header $trailer $path_count]
+}
+
+# Read the columns of the first path in the first row group.
+proc read_first_path { filename } {
+  set stream [open $filename r]
+  fconfigure $stream -translation binary
+  set data [read $stream]
+  close $stream
+  # Skip the header and version to the first row group.
+  set offset 12
+  binary scan $data @${offset}aiuiuiu tag path_count pin_count string_count
+  incr offset 13
+  set strings {}
+  for { set i 0 } { $i < $string_count } { incr i } {
+    binary scan $data @${offset}iu length
+    incr offset 4
+    lappend strings [string range $data $offset [expr { $offset + $length - 1 }]]
+    incr offset $length
+  }
+  binary scan $data @${offset}iu${path_count}iu${path_count}iu${path_count} \
+    groups starts ends
+  # Skip the group, startpoint, endpoint and min_max columns.
+  incr offset [expr { 13 * $path_count }]
+  binary scan $data @${offset}r${path_count}r${path_count}r${path_count}iu${path_count} \
+    slacks arrivals requireds pin_counts
+  incr offset [expr { 16 * $path_count }]
+  binary scan $data @${offset}iu[lindex $pin_counts 0] pins
+  set pin_names {}
+  foreach pin $pins {
+    lappend pin_names [lindex $strings $pin]
+  }
+  return [list $tag [lindex $strings [lindex $groups 0]] \
+            [lindex $strings [lindex $starts 0]] \
+            [lindex $strings [lindex $ends 0]] \
+            [lindex $requireds 0] [lindex $arrivals 0] [lindex $slacks 0] \
+            $pin_names]
+}
+
+set path_count [llength [find_timing_paths -path_delay min_max \
+                           -group_path_count 10]]
+set filename [file join results write_timing_paths.paths]
+write_timing_paths -path_delay min_max -group_path_count 10 $filename
+lassign [read_paths_file $filename] header trailer file_path_count
+puts "$header $trailer [expr { $file_path_count == $path_count }]"
+write_timing_paths -path_delay min_max -group_path_count 10 \
+  -sort_by_slack $filename
+lassign [read_paths_file $filename] header trailer file_path_count
+puts "sorted $header $trailer [expr { $file_path_count == $path_count }]"
+
+write_timing_paths -path_delay max $filename
+lassign [read_first_path $filename] tag group startpoint endpoint \
+  required arrival slack pin_names
+puts "$tag $group $startpoint $endpoint"
+puts $pin_names
+puts "[sta::format_time $required 2] [sta::format_time $arrival 2] [sta::format_time $slack 2]"
+with_output_to_variable report { report_checks -path_delay max -format end }
+foreach line [split $report "\n"] {
+  if { [lindex $line 0] == $endpoint } {
+    puts "report_checks [lrange $line 2 4]"
+  }
+}
+set path_end [lindex [find_timing_paths -path_delay max] 0]
+set points {}
+foreach point [get_property $path_end points] {
+  lappend points [get_full_name [get_property $point pin]]
+}
+puts "startpoint [expr { $startpoint == [get_full_name [get_property $path_end startpoint]] }]"
+puts "points [expr { [lrange $pin_names end-[expr { [llength $points] - 1 }] end] == $points }]"
+
+puts "format error [catch { write_timing_paths -format rows $filename }]"
+puts "write error [catch { write_timing_paths [file join results missing_dir x.paths] }]"
@@ -118,7 +118,8 @@ Debug::reportLine(const char *what,
 {
   va_list args;
   va_start(args, fmt);
-  std::unique_lock<std::mutex> lock(buffer_lock_);
+  // Debug lines share the report buffer with other threads.
+  std::unique_lock<std::mutex> lock(report_->buffer_lock_);
   report_->printToBuffer("%s", what);
   report_->printToBufferAppend(": ");
   report_->printToBufferAppend(fmt, args);
@@ -36,6 +36,7 @@ namespace sta {
 using std::min;
 
 Report *Report::default_ = nullptr;
+thread_local std::string *Report::thread_lines_ = nullptr;
 
 Report::Report() :
   log_stream_(nullptr),
@@ -65,8 +66,26 @@ void
 Report::printLine(const char *line,
                   size_t length)
 {
-  printString(line, length);
-  printString("\n", 1);
+  if (thread_lines_) {
+    thread_lines_->append(line, length);
+    thread_lines_->push_back('\n');
+  }
+  else {
+    printString(line, length);
+    printString("\n", 1);
+  }
+}
+
+void
+Report::captureThreadLinesBegin(std::string *lines)
+{
+  thread_lines_ = lines;
+}
+
+void
+Report::captureThreadLinesEnd()
+{
+  thread_lines_ = nullptr;
 }
 
 size_t
@@ -185,6 +204,7 @@ Report::warn(int id,
   if (!isSuppressed(id)) {
     va_list args;
     va_start(args, fmt);
+    std::unique_lock<std::mutex> lock(buffer_lock_);
     printToBuffer("Warning: ");
     printToBufferAppend(fmt, args);
     printBufferLine();
@@ -199,6 +219,7 @@ Report::vwarn(int id,
 {
   // Skip suppressed messages.
   if (!isSuppressed(id)) {
+    std::unique_lock<std::mutex> lock(buffer_lock_);
     printToBuffer("Warning: ");
     printToBufferAppend(fmt, args);
     printBufferLine();
@@ -216,6 +237,7 @@ Report::fileWarn(int id,
   if (!isSuppressed(id)) {
     va_list args;
     va_start(args, fmt);
+    std::unique_lock<std::mutex> lock(buffer_lock_);
     printToBuffer("Warning: %s line %d, ", filename, line);
     printToBufferAppend(fmt, args);
     printBufferLine();
@@ -232,6 +254,7 @@ Report::vfileWarn(int id,
 {
   // Skip suppressed messages.
   if (!isSuppressed(id)) {
+    std::unique_lock<std::mutex> lock(buffer_lock_);
     printToBuffer("Warning: %s line %d, ", filename, line);
     printToBufferAppend(fmt, args);
     printBufferLine();
@@ -247,6 +270,7 @@ Report::error(int id,
   va_list args;
   va_start(args, fmt);
   // No prefix msg, no \n.
+  std::unique_lock<std::mutex> lock(buffer_lock_);
   printToBuffer(fmt, args);
   va_end(args);
   throw ExceptionMsg(buffer_, isSuppressed(id));
@@ -258,6 +282,7 @@ Report::verror(int id,
                va_list args)
 {
   // No prefix msg, no \n.
+  std::unique_lock<std::mutex> lock(buffer_lock_);
   printToBuffer(fmt, args);
   throw ExceptionMsg(buffer_, isSuppressed(id));
 }
@@ -272,6 +297,7 @@ Report::fileError(int id,
   va_list args;
   va_start(args, fmt);
   // No prefix msg, no \n.
+  std::unique_lock<std::mutex> lock(buffer_lock_);
   printToBuffer("%s line %d, ", filename, line);
   printToBufferAppend(fmt, args);
   va_end(args);
@@ -286,6 +312,7 @@ Report::vfileError(int id,
                    va_list args)
 {
   // No prefix msg, no \n.
+  std::unique_lock<std::mutex> lock(buffer_lock_);
   printToBuffer("%s line %d, ", filename, line);
   printToBufferAppend(fmt, args);
   throw ExceptionMsg(buffer_, isSuppressed(id));
@@ -300,6 +327,7 @@ Report::critical(int /* id */,
 {
   va_list args;
   va_start(args, fmt);
+  std::unique_lock<std::mutex> lock(buffer_lock_);
   printToBuffer("Critical: ");
   printToBufferAppend(fmt, args);
   printBufferLine();
@@ -316,6 +344,7 @@ Report::fileCritical(int /* id */,
 {
   va_list args;
   va_start(args, fmt);
+  std::unique_lock<std::mutex> lock(buffer_lock_);
   printToBuffer("Critical: %s line %d, ", filename, line);
   printToBufferAppend(fmt, args);
   printBufferLine();